@@ -0,0 +1,3 @@
+DELETE FROM `command` WHERE `name`='debug opcodestats';
+INSERT INTO `command` (`name`, `help`) VALUES
+('debug opcodestats', 'Syntax: .debug opcodestats [reset] [#count]\r\n\r\nShows the #count (default 10) client opcodes with the highest estimated handler time collected by the opcode profiler (OpcodeProfiler.Enable). With reset, clears collected statistics.');
@@ -0,0 +1,3 @@
+DELETE FROM `command` WHERE `name`='debug objectmemory';
+INSERT INTO `command` (`name`, `help`) VALUES
+('debug objectmemory', 'Syntax: .debug objectmemory [#mapId]\r\n\r\nShows update field memory used by objects of each type on all maps, or only on maps with #mapId: number of objects, values storage, and how many objects allocated change masks and dynamic fields.');
@@ -0,0 +1,3 @@
+DELETE FROM `command` WHERE `name`='debug objectpools';
+INSERT INTO `command` (`name`, `help`) VALUES
+('debug objectpools', 'Syntax: .debug objectpools\r\n\r\nShows usage of slab allocators backing creatures, gameobjects, areatriggers, dynamic objects, auras, aura effects and spells: live objects, reserved slots and memory, and allocations of derived types served by the global allocator.');
@@ -23,13 +23,234 @@
 #include "Errors.h"
 #include "Logger.h"
 #include "LogMessage.h"
-#include "LogOperation.h"
-#include "Strand.h"
+#include "LogRingBuffer.h"
 #include "StringConvert.h"
 #include "Util.h"
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
+#include <thread>
+
+// Moves formatted messages from per thread ring buffers to appenders on a dedicated thread
+// Logging threads normally never block on I/O or on each other. When their buffer is full, ERROR and FATAL
+// messages are written synchronously and lower levels are dropped and counted instead.
+// Messages too large for any buffer are always written synchronously.
+// After SetSynchronous every message is written synchronously, the writer thread only empties the buffers left behind
+// and is kept alive until the log is destroyed so threads still logging never see it go away.
+class Log::AsyncWriter
+{
+public:
+    AsyncWriter(Log* log, std::size_t bufferSize);
+    ~AsyncWriter();
+
+    AsyncWriter(AsyncWriter const&) = delete;
+    AsyncWriter(AsyncWriter&&) = delete;
+    AsyncWriter& operator=(AsyncWriter const&) = delete;
+    AsyncWriter& operator=(AsyncWriter&&) = delete;
+
+    void Write(LogRingBuffer::Record const& record);
+    bool IsWritingToAppenders() const;
+    void SetSynchronous();
+    bool IsSynchronous() const { return _synchronous.load(std::memory_order_acquire); }
+    uint64 GetDroppedMessageCount() const { return _droppedMessages.load(std::memory_order_relaxed); }
+
+private:
+    LogRingBuffer* GetThreadBuffer();
+    void WriteDirect(LogRingBuffer* buffer, LogRingBuffer::Record const& record);
+    static void WriteRecord(LogRingBuffer::Record const& record);
+    void Run();
+    std::size_t Drain();
+    void ReportDroppedMessages();
+
+    Log* _log;
+    std::size_t _bufferSize;
+    uint32 _generation;
+
+    std::mutex _buffersLock;
+    std::vector<std::shared_ptr<LogRingBuffer>> _buffers;
+    std::vector<std::shared_ptr<LogRingBuffer>> _drainBuffers;  // only accessed by writer thread
+
+    std::mutex _appendersLock;                  // held while writing to appenders or draining a buffer
+
+    std::mutex _wakeLock;
+    std::condition_variable _wakeCondition;
+    std::atomic<bool> _stop;
+    std::atomic<bool> _synchronous;
+
+    std::atomic<uint64> _droppedMessages;
+    uint64 _reportedDroppedMessages;
+    TimePoint _nextDroppedMessagesReport;
+
+    std::thread _thread;
+};
+
+namespace
+{
+std::atomic<uint32> AsyncWriterGeneration = 0;
+
+struct ThreadLogBuffer
+{
+    ~ThreadLogBuffer()
+    {
+        if (Buffer)
+            Buffer->Close();
+    }
+
+    std::shared_ptr<LogRingBuffer> Buffer;
+    uint32 Generation = 0;
+};
+
+thread_local ThreadLogBuffer CurrentThreadLogBuffer;
+thread_local bool IsWritingDirectly = false;
+}
+
+Log::AsyncWriter::AsyncWriter(Log* log, std::size_t bufferSize) : _log(log), _bufferSize(bufferSize), _generation(++AsyncWriterGeneration),
+    _stop(false), _synchronous(false), _droppedMessages(0), _reportedDroppedMessages(0), _nextDroppedMessagesReport(TimePoint::min())
+{
+    _thread = std::thread(&AsyncWriter::Run, this);
+}
+
+Log::AsyncWriter::~AsyncWriter()
+{
+    _stop.store(true, std::memory_order_release);
+    _wakeCondition.notify_one();
+    _thread.join();
+}
+
+LogRingBuffer* Log::AsyncWriter::GetThreadBuffer()
+{
+    ThreadLogBuffer& threadBuffer = CurrentThreadLogBuffer;
+    if (threadBuffer.Generation != _generation)
+    {
+        if (threadBuffer.Buffer)
+            threadBuffer.Buffer->Close();
+
+        threadBuffer.Buffer = std::make_shared<LogRingBuffer>(_bufferSize);
+        threadBuffer.Generation = _generation;
+
+        std::lock_guard<std::mutex> lock(_buffersLock);
+        _buffers.push_back(threadBuffer.Buffer);
+    }
+
+    return threadBuffer.Buffer.get();
+}
+
+bool Log::AsyncWriter::IsWritingToAppenders() const
+{
+    return IsWritingDirectly || std::this_thread::get_id() == _thread.get_id();
+}
+
+void Log::AsyncWriter::Write(LogRingBuffer::Record const& record)
+{
+    LogRingBuffer* buffer = GetThreadBuffer();
+    if (IsSynchronous())
+    {
+        WriteDirect(buffer, record);
+        return;
+    }
+
+    if (buffer->Push(record))
+        return;
+
+    if (record.Level < LOG_LEVEL_ERROR && buffer->CanStore(record))
+    {
+        _droppedMessages.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    WriteDirect(buffer, record);
+}
+
+void Log::AsyncWriter::WriteDirect(LogRingBuffer* buffer, LogRingBuffer::Record const& record)
+{
+    std::lock_guard<std::mutex> lock(_appendersLock);
+    IsWritingDirectly = true;
+
+    // the writer thread is not draining while we hold the lock, write what this thread queued earlier first to keep its order
+    buffer->Drain(&WriteRecord);
+    WriteRecord(record);
+    _log->FlushAppenders();
 
-Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _ioContext(nullptr), _strand(nullptr)
+    IsWritingDirectly = false;
+}
+
+void Log::AsyncWriter::SetSynchronous()
+{
+    _synchronous.store(true, std::memory_order_release);
+    _wakeCondition.notify_one();
+}
+
+void Log::AsyncWriter::WriteRecord(LogRingBuffer::Record const& record)
+{
+    LogMessage msg(record.Level, std::string(record.Type), std::string(record.Text), std::string(record.Param1));
+    msg.mtime = record.Time;
+    record.Destination->write(&msg);
+}
+
+void Log::AsyncWriter::Run()
+{
+    while (!_stop.load(std::memory_order_acquire))
+    {
+        if (Drain())
+            continue;
+
+        std::unique_lock<std::mutex> lock(_wakeLock);
+        _wakeCondition.wait_for(lock, 10ms);
+    }
+
+    while (Drain())
+        ;
+}
+
+std::size_t Log::AsyncWriter::Drain()
+{
+    {
+        std::lock_guard<std::mutex> lock(_buffersLock);
+        // buffers of finished threads are released once everything they logged has been written
+        std::erase_if(_buffers, [](std::shared_ptr<LogRingBuffer> const& buffer) { return buffer->IsClosed() && buffer->IsEmpty(); });
+        _drainBuffers.assign(_buffers.begin(), _buffers.end());
+    }
+
+    std::size_t written = 0;
+    {
+        std::lock_guard<std::mutex> lock(_appendersLock);
+        for (std::shared_ptr<LogRingBuffer> const& buffer : _drainBuffers)
+        {
+            // flush every batch, a crash must not lose messages that already left the buffer
+            if (std::size_t batch = buffer->Drain(&WriteRecord))
+            {
+                _log->FlushAppenders();
+                written += batch;
+            }
+        }
+
+        // the warning goes to the same appenders, write it while no other thread can
+        ReportDroppedMessages();
+    }
+
+    _drainBuffers.clear();
+    return written;
+}
+
+void Log::AsyncWriter::ReportDroppedMessages()
+{
+    uint64 droppedMessages = _droppedMessages.load(std::memory_order_relaxed);
+    if (droppedMessages == _reportedDroppedMessages)
+        return;
+
+    TimePoint now = std::chrono::steady_clock::now();
+    if (now < _nextDroppedMessagesReport)
+        return;
+
+    TC_LOG_WARN("server", "Log::AsyncWriter: Dropped {} log messages because logging threads filled their buffers faster than they could be written, consider increasing Log.Async.BufferSize",
+        droppedMessages - _reportedDroppedMessages);
+    _log->FlushAppenders();
+
+    _reportedDroppedMessages = droppedMessages;
+    _nextDroppedMessagesReport = now + 10s;
+}
+
+Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
@@ -38,7 +259,7 @@ Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _ioContext(nullptr)
 
 Log::~Log()
 {
-    delete _strand;
+    _asyncWriter.reset();
     Close();
 }
 
@@ -223,25 +444,41 @@ void Log::RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn)
 
 void Log::OutMessageImpl(std::string_view filter, LogLevel level, std::string&& message)
 {
-    write(std::make_unique<LogMessage>(level, std::string(filter), std::move(message)));
+    write(level, filter, std::move(message));
 }
 
 void Log::OutCommandImpl(std::string&& message, std::string&& param1)
 {
-    write(std::make_unique<LogMessage>(LOG_LEVEL_INFO, "commands.gm", std::move(message), std::move(param1)));
+    write(LOG_LEVEL_INFO, "commands.gm", std::move(message), std::move(param1));
 }
 
-void Log::write(std::unique_ptr<LogMessage>&& msg) const
+void Log::write(LogLevel level, std::string_view type, std::string&& text, std::string&& param1 /*= {}*/) const
 {
-    Logger const* logger = GetLoggerByType(msg->type);
+    Logger const* logger = GetLoggerByType(type);
 
-    if (_ioContext)
+    // messages logged by appenders themselves are written immediately, a thread writing to appenders can't wait for its own buffer
+    if (_asyncWriter && !_asyncWriter->IsWritingToAppenders())
     {
-        std::shared_ptr<LogOperation> logOperation = std::make_shared<LogOperation>(logger, std::move(msg));
-        Trinity::Asio::post(*_ioContext, Trinity::Asio::bind_executor(*_strand, [logOperation]() { logOperation->call(); }));
+        LogRingBuffer::Record record;
+        record.Level = level;
+        record.Destination = logger;
+        record.Time = time(nullptr);
+        record.Type = type;
+        record.Text = text;
+        record.Param1 = param1;
+        _asyncWriter->Write(record);
     }
     else
-        logger->write(msg.get());
+    {
+        LogMessage msg(level, std::string(type), std::move(text), std::move(param1));
+        logger->write(&msg);
+    }
+}
+
+void Log::FlushAppenders()
+{
+    for (std::pair<uint8 const, std::unique_ptr<Appender>>& appender : appenders)
+        appender.second->flush();
 }
 
 Logger const* Log::GetLoggerByType(std::string_view type) const
@@ -329,13 +566,10 @@ void Log::OutCharDump(char const* str, uint32 accountId, uint64 guid, char const
     ss << "== START DUMP == (account: " << accountId << " guid: " << guid << " name: " << name
        << ")\n" << str << "\n== END DUMP ==\n";
 
-    std::unique_ptr<LogMessage> msg(new LogMessage(LOG_LEVEL_INFO, "entities.player.dump", ss.str()));
     std::ostringstream param;
     param << guid << '_' << name;
 
-    msg->param1 = param.str();
-
-    write(std::move(msg));
+    write(LOG_LEVEL_INFO, "entities.player.dump", ss.str(), param.str());
 }
 
 void Log::SetRealmId(uint32 id)
@@ -374,22 +608,29 @@ Log* Log::instance()
     return &instance;
 }
 
-void Log::Initialize(Trinity::Asio::IoContext* ioContext)
+void Log::Initialize(bool async)
 {
-    if (ioContext)
-    {
-        _ioContext = ioContext;
-        _strand = new Trinity::Asio::Strand(*ioContext);
-    }
-
     LoadFromConfig();
+
+    if (async)
+        _asyncWriter = std::make_unique<AsyncWriter>(this, std::size_t(std::max(sConfigMgr->GetIntDefault("Log.Async.BufferSize", 256 * 1024), 0)));
 }
 
 void Log::SetSynchronous()
 {
-    delete _strand;
-    _strand = nullptr;
-    _ioContext = nullptr;
+    // the writer is not destroyed here, other threads may be inside AsyncWriter::Write
+    if (_asyncWriter)
+        _asyncWriter->SetSynchronous();
+}
+
+bool Log::IsAsync() const
+{
+    return _asyncWriter && !_asyncWriter->IsSynchronous();
+}
+
+uint64 Log::GetDroppedMessageCount() const
+{
+    return _asyncWriter ? _asyncWriter->GetDroppedMessageCount() : 0;
 }
 
 void Log::LoadFromConfig()
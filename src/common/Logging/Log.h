@@ -19,7 +19,6 @@
 #define TRINITYCORE_LOG_H
 
 #include "Define.h"
-#include "AsioHacksFwd.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
 #include <memory>
@@ -30,14 +29,6 @@ class Appender;
 class Logger;
 struct LogMessage;
 
-namespace Trinity
-{
-    namespace Asio
-    {
-        class IoContext;
-    }
-}
-
 #define LOGGER_ROOT "root"
 
 typedef Appender*(*AppenderCreatorFn)(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& extraArgs);
@@ -61,8 +52,10 @@ class TC_COMMON_API Log
     public:
         static Log* instance();
 
-        void Initialize(Trinity::Asio::IoContext* ioContext);
-        void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
+        void Initialize(bool async);
+        void SetSynchronous();
+        bool IsAsync() const;
+        uint64 GetDroppedMessageCount() const;
         void LoadFromConfig();
         void Close();
         bool ShouldLog(std::string_view type, LogLevel level) const;
@@ -100,8 +93,11 @@ class TC_COMMON_API Log
         void CreateLoggerFromConfigLine(std::string const& name, std::string const& options);
 
     private:
+        class AsyncWriter;
+
         static std::string GetTimestampStr();
-        void write(std::unique_ptr<LogMessage>&& msg) const;
+        void write(LogLevel level, std::string_view type, std::string&& text, std::string&& param1 = {}) const;
+        void FlushAppenders();
 
         Logger const* GetLoggerByType(std::string_view type) const;
         Appender* GetAppenderByName(std::string_view name);
@@ -123,8 +119,7 @@ class TC_COMMON_API Log
         std::string m_logsDir;
         std::string m_logsTimestamp;
 
-        Trinity::Asio::IoContext* _ioContext;
-        Trinity::Asio::Strand* _strand;
+        std::unique_ptr<AsyncWriter> _asyncWriter;
 };
 
 #define sLog Log::instance()
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogRingBuffer.h"
+#include <new>
+
+LogRingBuffer::LogRingBuffer(std::size_t capacity) : _queue(capacity), _closed(false)
+{
+}
+
+LogRingBuffer::~LogRingBuffer() = default;
+
+bool LogRingBuffer::CanStore(Record const& record) const
+{
+    return record.Type.length() <= 0xFFFF
+        && sizeof(RecordHeader) + record.Type.length() + record.Text.length() + record.Param1.length() <= _queue.GetMaxRecordSize();
+}
+
+bool LogRingBuffer::Push(Record const& record)
+{
+    if (!CanStore(record))
+        return false;
+
+    std::size_t const typeLength = record.Type.length();
+    std::size_t const textLength = record.Text.length();
+    std::size_t const param1Length = record.Param1.length();
+
+    void* storage = _queue.Reserve(sizeof(RecordHeader) + typeLength + textLength + param1Length);
+    if (!storage)
+        return false;
+
+    RecordHeader* header = new (storage) RecordHeader();
+    header->Destination = record.Destination;
+    header->Time = int64(record.Time);
+    header->TextLength = uint32(textLength);
+    header->Param1Length = uint32(param1Length);
+    header->TypeLength = uint16(typeLength);
+    header->Level = uint8(record.Level);
+
+    char* data = reinterpret_cast<char*>(header + 1);
+    data += record.Type.copy(data, typeLength);
+    data += record.Text.copy(data, textLength);
+    record.Param1.copy(data, param1Length);
+
+    _queue.Commit();
+    return true;
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LOG_RING_BUFFER_H
+#define TRINITYCORE_LOG_RING_BUFFER_H
+
+#include "Define.h"
+#include "LogCommon.h"
+#include "SPSCByteQueue.h"
+#include <atomic>
+#include <ctime>
+#include <string_view>
+
+class Logger;
+
+// Single producer single consumer queue holding preformatted log messages
+// Every logging thread owns one, the log writer thread is the only consumer
+class TC_COMMON_API LogRingBuffer
+{
+public:
+    struct Record
+    {
+        LogLevel Level;
+        Logger const* Destination;
+        time_t Time;
+        std::string_view Type;
+        std::string_view Text;
+        std::string_view Param1;
+    };
+
+    explicit LogRingBuffer(std::size_t capacity);
+    ~LogRingBuffer();
+
+    LogRingBuffer(LogRingBuffer const&) = delete;
+    LogRingBuffer(LogRingBuffer&&) = delete;
+    LogRingBuffer& operator=(LogRingBuffer const&) = delete;
+    LogRingBuffer& operator=(LogRingBuffer&&) = delete;
+
+    // Producer side, returns false without writing anything if the record doesn't fit
+    bool Push(Record const& record);
+
+    // Records too large for this buffer can never be pushed and have to be written directly
+    bool CanStore(Record const& record) const;
+
+    // Consumer side, calls callback for every record currently in the buffer and returns number of records read
+    template<typename Callback>
+    std::size_t Drain(Callback&& callback);
+
+    bool IsEmpty() const { return _queue.IsEmpty(); }
+
+    // Marks the buffer as abandoned by its producing thread, it gets released by the consumer once drained
+    void Close() { _closed.store(true, std::memory_order_release); }
+    bool IsClosed() const { return _closed.load(std::memory_order_acquire); }
+
+private:
+    struct RecordHeader
+    {
+        Logger const* Destination;
+        int64 Time;
+        uint32 TextLength;
+        uint32 Param1Length;
+        uint16 TypeLength;
+        uint8 Level;
+    };
+
+    Trinity::SPSCByteQueue _queue;
+    std::atomic<bool> _closed;
+};
+
+template<typename Callback>
+std::size_t LogRingBuffer::Drain(Callback&& callback)
+{
+    return _queue.Drain([&](void const* data, std::size_t /*size*/)
+    {
+        RecordHeader const* header = static_cast<RecordHeader const*>(data);
+        char const* strings = reinterpret_cast<char const*>(header + 1);
+
+        Record record;
+        record.Level = LogLevel(header->Level);
+        record.Destination = header->Destination;
+        record.Time = time_t(header->Time);
+        record.Type = { strings, header->TypeLength };
+        record.Text = { strings + header->TypeLength, header->TextLength };
+        record.Param1 = { strings + header->TypeLength + header->TextLength, header->Param1Length };
+        callback(record);
+    });
+}
+
+#endif // TRINITYCORE_LOG_RING_BUFFER_H
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_SPSC_BYTE_QUEUE_H
+#define TRINITYCORE_SPSC_BYTE_QUEUE_H
+
+#include "Define.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
+
+namespace Trinity
+{
+// Lock free single producer single consumer queue of variable sized byte records stored in a ring buffer
+// Records never wrap around the end of the ring, their data is always contiguous and 8 byte aligned
+class SPSCByteQueue
+{
+public:
+    explicit SPSCByteQueue(std::size_t capacity) : _head(0), _tail(0)
+    {
+        _capacity = std::bit_ceil(std::max<std::size_t>(capacity, 4096));
+        _mask = _capacity - 1;
+        _buffer = std::make_unique<char[]>(_capacity);
+        _pendingHead = 0;
+    }
+
+    SPSCByteQueue(SPSCByteQueue const&) = delete;
+    SPSCByteQueue(SPSCByteQueue&&) = delete;
+    SPSCByteQueue& operator=(SPSCByteQueue const&) = delete;
+    SPSCByteQueue& operator=(SPSCByteQueue&&) = delete;
+
+    std::size_t GetCapacity() const { return _capacity; }
+
+    // Largest record that can ever be stored
+    std::size_t GetMaxRecordSize() const { return _capacity / 2 - sizeof(RecordHeader); }
+
+    // Producer side, returns storage for a record of given size or nullptr if there is not enough free space
+    // Record becomes visible to consumer after Commit()
+    void* Reserve(std::size_t size)
+    {
+        std::size_t const recordSize = AlignSize(sizeof(RecordHeader) + size);
+        std::size_t const head = _head.load(std::memory_order_relaxed);
+        std::size_t const tail = _tail.load(std::memory_order_acquire);
+        std::size_t offset = head & _mask;
+        std::size_t const contiguous = _capacity - offset;
+
+        std::size_t required = recordSize;
+        if (contiguous < recordSize)
+            required += contiguous;
+
+        if (_capacity - (head - tail) < required)
+            return nullptr;
+
+        _pendingHead = head;
+        if (contiguous < recordSize)
+        {
+            // skip remaining space at the end of the ring
+            RecordHeader padding{ .Size = uint32(contiguous - sizeof(RecordHeader)), .Flags = RECORD_FLAG_PADDING };
+            memcpy(&_buffer[offset], &padding, sizeof(padding));
+            _pendingHead += contiguous;
+            offset = 0;
+        }
+
+        RecordHeader header{ .Size = uint32(size), .Flags = RECORD_FLAG_NONE };
+        memcpy(&_buffer[offset], &header, sizeof(header));
+        _pendingHead += recordSize;
+        return &_buffer[offset + sizeof(RecordHeader)];
+    }
+
+    void Commit()
+    {
+        _head.store(_pendingHead, std::memory_order_release);
+    }
+
+    // Consumer side, calls callback(void const* data, std::size_t size) for every committed record and returns number of records read
+    template<typename Callback>
+    std::size_t Drain(Callback&& callback)
+    {
+        std::size_t read = 0;
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        std::size_t const head = _head.load(std::memory_order_acquire);
+        while (tail != head)
+        {
+            RecordHeader header;
+            memcpy(&header, &_buffer[tail & _mask], sizeof(header));
+            if (!(header.Flags & RECORD_FLAG_PADDING))
+            {
+                callback(static_cast<void const*>(&_buffer[(tail & _mask) + sizeof(RecordHeader)]), std::size_t(header.Size));
+                ++read;
+            }
+
+            tail += AlignSize(sizeof(RecordHeader) + header.Size);
+            _tail.store(tail, std::memory_order_release);
+        }
+
+        return read;
+    }
+
+    bool IsEmpty() const { return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire); }
+
+private:
+    enum RecordFlags : uint32
+    {
+        RECORD_FLAG_NONE    = 0x0,
+        RECORD_FLAG_PADDING = 0x1
+    };
+
+    struct RecordHeader
+    {
+        uint32 Size;
+        uint32 Flags;
+    };
+
+    static constexpr std::size_t RecordAlignment = 8;
+
+    static constexpr std::size_t AlignSize(std::size_t size) { return (size + RecordAlignment - 1) & ~(RecordAlignment - 1); }
+
+    std::unique_ptr<char[]> _buffer;
+    std::size_t _capacity;
+    std::size_t _mask;
+    std::size_t _pendingHead;                       // only accessed by producer
+
+    alignas(64) std::atomic<std::size_t> _head;     // written by producer
+    alignas(64) std::atomic<std::size_t> _tail;     // written by consumer
+};
+}
+
+#endif // TRINITYCORE_SPSC_BYTE_QUEUE_H
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ObjectPool.h"
+#include <algorithm>
+
+namespace
+{
+struct ObjectPoolRegistry
+{
+    std::mutex Lock;
+    std::vector<Trinity::ObjectPoolBase*> Pools;
+
+    static ObjectPoolRegistry& Instance()
+    {
+        static ObjectPoolRegistry instance;
+        return instance;
+    }
+};
+}
+
+Trinity::ObjectPoolBase::ObjectPoolBase(char const* name) : _name(name)
+{
+    ObjectPoolRegistry& registry = ObjectPoolRegistry::Instance();
+    std::lock_guard<std::mutex> lock(registry.Lock);
+    registry.Pools.push_back(this);
+}
+
+Trinity::ObjectPoolBase::~ObjectPoolBase()
+{
+    ObjectPoolRegistry& registry = ObjectPoolRegistry::Instance();
+    std::lock_guard<std::mutex> lock(registry.Lock);
+    registry.Pools.erase(std::remove(registry.Pools.begin(), registry.Pools.end(), this), registry.Pools.end());
+}
+
+std::vector<Trinity::ObjectPoolStatistics> Trinity::ObjectPoolBase::GetAllStatistics()
+{
+    ObjectPoolRegistry& registry = ObjectPoolRegistry::Instance();
+    std::lock_guard<std::mutex> lock(registry.Lock);
+
+    std::vector<ObjectPoolStatistics> stats;
+    stats.reserve(registry.Pools.size());
+    for (ObjectPoolBase const* pool : registry.Pools)
+        stats.push_back(pool->GetStatistics());
+
+    return stats;
+}
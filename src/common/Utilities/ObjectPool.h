@@ -0,0 +1,243 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRINITY_OBJECT_POOL_H
+#define TRINITY_OBJECT_POOL_H
+
+#include "Define.h"
+#include "Errors.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// clang does not define __SANITIZE_ADDRESS__
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define TRINITY_OBJECT_POOL_HAS_ADDRESS_SANITIZER 1
+#endif
+#endif
+
+#ifndef TRINITY_OBJECT_POOL_HAS_ADDRESS_SANITIZER
+#define TRINITY_OBJECT_POOL_HAS_ADDRESS_SANITIZER 0
+#endif
+
+namespace Trinity
+{
+struct ObjectPoolStatistics
+{
+    char const* Name = nullptr;
+    std::size_t SlotSize = 0;
+    uint64 Allocations = 0;             // objects served from slabs
+    uint64 Deallocations = 0;           // objects returned to slabs
+    uint64 Fallbacks = 0;               // derived types of different size, served by global operator new
+    uint64 Slabs = 0;
+    uint64 Capacity = 0;                // slots in all slabs
+    uint64 CentralFreeSlots = 0;        // free slots not held by any thread cache
+};
+
+class TC_COMMON_API ObjectPoolBase
+{
+public:
+    explicit ObjectPoolBase(char const* name);
+    virtual ~ObjectPoolBase();
+
+    ObjectPoolBase(ObjectPoolBase const&) = delete;
+    ObjectPoolBase& operator=(ObjectPoolBase const&) = delete;
+
+    char const* GetName() const { return _name; }
+    virtual ObjectPoolStatistics GetStatistics() const = 0;
+
+    static std::vector<ObjectPoolStatistics> GetAllStatistics();
+
+private:
+    char const* _name;
+};
+
+// Slab allocator for frequently created and destroyed objects of a single type, meant to back class specific operator new/delete
+// Each thread keeps its own free list and exchanges slots with the shared pool in batches, so allocation and deallocation
+// normally take no lock. Slabs are only released when the pool is destroyed.
+// Requests with a size other than sizeof(T) (derived classes inheriting operator new) are forwarded to global operator new.
+template<typename T>
+class ObjectPool final : public ObjectPoolBase
+{
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "ObjectPool does not support overaligned types");
+
+    static constexpr std::size_t SlotAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    static constexpr std::size_t SlotSize = (std::max(sizeof(T), sizeof(void*)) + SlotAlignment - 1) / SlotAlignment * SlotAlignment;
+    static constexpr std::size_t SlotsPerSlab = std::max<std::size_t>(16, 64 * 1024 / SlotSize);
+    static constexpr std::size_t TransferBatchSize = 32;
+
+#if defined(ASAN) || defined(__SANITIZE_ADDRESS__) || TRINITY_OBJECT_POOL_HAS_ADDRESS_SANITIZER
+    // keep use after free detectable by sanitizers
+    static constexpr bool Enabled = false;
+#else
+    static constexpr bool Enabled = true;
+#endif
+
+    struct FreeSlot
+    {
+        FreeSlot* Next;
+    };
+
+    struct FreeList
+    {
+        FreeSlot* Head = nullptr;
+        std::size_t Count = 0;
+
+        void Push(void* ptr)
+        {
+            FreeSlot* slot = static_cast<FreeSlot*>(ptr);
+            slot->Next = Head;
+            Head = slot;
+            ++Count;
+        }
+
+        void* Pop()
+        {
+            FreeSlot* slot = Head;
+            Head = slot->Next;
+            --Count;
+            return slot;
+        }
+
+        // moves up to count slots from other to the front of this list
+        void Splice(FreeList& other, std::size_t count)
+        {
+            while (count-- && other.Head)
+                Push(other.Pop());
+        }
+    };
+
+    struct ThreadCache
+    {
+        ObjectPool* Pool = nullptr;
+        FreeList Slots;
+
+        ~ThreadCache()
+        {
+            if (Pool)
+                Pool->ReleaseSlots(Slots, Slots.Count);
+        }
+    };
+
+public:
+    explicit ObjectPool(char const* name) : ObjectPoolBase(name), _allocations(0), _deallocations(0), _fallbacks(0) { }
+
+    void* Allocate(std::size_t size)
+    {
+        if (!Enabled || size != sizeof(T))
+        {
+            _fallbacks.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(size);
+        }
+
+        ThreadCache& cache = GetThreadCache();
+        if (!cache.Slots.Head)
+            AcquireSlots(cache.Slots);
+
+        _allocations.fetch_add(1, std::memory_order_relaxed);
+        return cache.Slots.Pop();
+    }
+
+    void Deallocate(void* ptr, std::size_t size)
+    {
+        if (!ptr)
+            return;
+
+        if (!Enabled || size != sizeof(T))
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        ThreadCache& cache = GetThreadCache();
+        cache.Slots.Push(ptr);
+        _deallocations.fetch_add(1, std::memory_order_relaxed);
+
+        // objects created on one map thread and destroyed on another should not pile up in a single cache
+        if (cache.Slots.Count >= TransferBatchSize * 2)
+            ReleaseSlots(cache.Slots, TransferBatchSize);
+    }
+
+    ObjectPoolStatistics GetStatistics() const override
+    {
+        ObjectPoolStatistics stats;
+        stats.Name = GetName();
+        stats.SlotSize = SlotSize;
+        stats.Allocations = _allocations.load(std::memory_order_relaxed);
+        stats.Deallocations = _deallocations.load(std::memory_order_relaxed);
+        stats.Fallbacks = _fallbacks.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(_lock);
+        stats.Slabs = _slabs.size();
+        stats.Capacity = _slabs.size() * SlotsPerSlab;
+        stats.CentralFreeSlots = _freeSlots.Count;
+        return stats;
+    }
+
+private:
+    ThreadCache& GetThreadCache()
+    {
+        static thread_local ThreadCache cache;
+        if (!cache.Pool)
+            cache.Pool = this;
+
+        ASSERT(cache.Pool == this, "Only one ObjectPool instance per type is supported");
+        return cache;
+    }
+
+    void AcquireSlots(FreeList& slots)
+    {
+        std::byte* memory;
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            if (_freeSlots.Head)
+            {
+                slots.Splice(_freeSlots, TransferBatchSize);
+                return;
+            }
+
+            memory = _slabs.emplace_back(new std::byte[SlotSize * SlotsPerSlab]).get();
+        }
+
+        // carve backwards so objects are handed out in address order
+        for (std::size_t i = SlotsPerSlab; i > 0; --i)
+            slots.Push(memory + (i - 1) * SlotSize);
+    }
+
+    void ReleaseSlots(FreeList& slots, std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _freeSlots.Splice(slots, count);
+    }
+
+    mutable std::mutex _lock;
+    std::vector<std::unique_ptr<std::byte[]>> _slabs;
+    FreeList _freeSlots;
+
+    std::atomic<uint64> _allocations;
+    std::atomic<uint64> _deallocations;
+    std::atomic<uint64> _fallbacks;
+};
+}
+
+#endif // TRINITY_OBJECT_POOL_H
@@ -34,6 +34,7 @@
 #include "IPLocation.h"
 #include "IpNetwork.h"
 #include "LoginRESTService.h"
+#include "Metric.h"
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "ProcessPriority.h"
@@ -116,7 +117,7 @@ int main(int argc, char** argv)
     }
 
     sLog->RegisterAppender<AppenderDB>();
-    sLog->Initialize(nullptr);
+    sLog->Initialize(false);
 
     Trinity::Banner::Show("bnetserver",
         [](char const* text)
@@ -170,6 +171,10 @@ int main(int argc, char** argv)
 
     Trinity::Net::ScanLocalNetworks();
 
+    sMetric->Initialize("", *ioContext, []() { });
+
+    std::shared_ptr<void> sMetricHandle(nullptr, [](void*) { sMetric->Unload(); });
+
     // Start the listening port (acceptor) for auth connections
     int32 bnport = sConfigMgr->GetIntDefault("BattlenetPort", 1119);
     if (bnport < 0 || bnport > 0xFFFF)
@@ -22,9 +22,11 @@
 #include "DatabaseEnv.h"
 #include "Errors.h"
 #include "IpNetwork.h"
+#include "Metric.h"
 #include "ProtobufJSON.h"
 #include "Resolver.h"
 #include "SslContext.h"
+#include "ThreadPool.h"
 #include "Util.h"
 #include "httpget.h"
 #include "httppost.h"
@@ -69,6 +71,13 @@ int32 handle_post_plugin(soap* soapClient)
     return sLoginService.HandleHttpRequest(soapClient, "POST", sLoginService._postHandlers);
 }
 
+LoginRESTService::LoginRESTService() : _ioContext(nullptr), _stopped(false), _port(0), _loginTicketDuration(0),
+    _passwordHashQueueSize(0), _passwordHashQueueMaxSize(0), _maxLoginAttemptsPerIp(0)
+{
+}
+
+LoginRESTService::~LoginRESTService() = default;
+
 bool LoginRESTService::Start(Trinity::Asio::IoContext* ioContext)
 {
     _ioContext = ioContext;
@@ -124,6 +133,26 @@ bool LoginRESTService::Start(Trinity::Asio::IoContext* ioContext)
 
     _loginTicketDuration = sConfigMgr->GetIntDefault("LoginREST.TicketDuration", 3600);
 
+    int32 handshakeThreads = sConfigMgr->GetIntDefault("LoginREST.HandshakeThreads", 2);
+    if (handshakeThreads <= 0)
+    {
+        TC_LOG_ERROR("server.rest", "LoginREST.HandshakeThreads must be greater than 0, defaulting to 1");
+        handshakeThreads = 1;
+    }
+
+    _handshakeThreads = std::make_unique<Trinity::ThreadPool>(handshakeThreads);
+
+    int32 passwordHashThreads = sConfigMgr->GetIntDefault("LoginREST.PasswordHashThreads", 1);
+    if (passwordHashThreads <= 0)
+    {
+        TC_LOG_ERROR("server.rest", "LoginREST.PasswordHashThreads must be greater than 0, defaulting to 1");
+        passwordHashThreads = 1;
+    }
+
+    _passwordHashThreads = std::make_unique<Trinity::ThreadPool>(passwordHashThreads);
+    _passwordHashQueueMaxSize = std::max(sConfigMgr->GetIntDefault("LoginREST.PasswordHashQueueSize", 256), 1);
+    _maxLoginAttemptsPerIp = std::max(sConfigMgr->GetIntDefault("LoginREST.MaxLoginAttemptsPerIp", 20), 0);
+
     _thread = std::thread(std::bind(&LoginRESTService::Run, this));
     return true;
 }
@@ -132,6 +161,13 @@ void LoginRESTService::Stop()
 {
     _stopped = true;
     _thread.join();
+
+    // drop handshakes that did not start yet, wait for the ones in progress
+    _handshakeThreads->Stop();
+    _handshakeThreads->Join();
+
+    _passwordHashThreads->Stop();
+    _passwordHashThreads->Join();
 }
 
 std::string const& LoginRESTService::GetHostnameForClient(boost::asio::ip::address const& address) const
@@ -189,21 +225,9 @@ void LoginRESTService::Run()
         if (!soap_valid_socket(soap_accept(&soapServer)))
             continue;   // ran into an accept timeout
 
+        // handshake is done on a separate pool so that slow clients and key exchange cost do not stall accepting new connections
         std::shared_ptr<AsyncRequest> soapClient = std::make_shared<AsyncRequest>(soapServer);
-        if (soap_ssl_accept(soapClient->GetClient()) != SOAP_OK)
-        {
-            TC_LOG_DEBUG("server.rest", "Failed SSL handshake from IP={}", boost::asio::ip::address_v4(soapClient->GetClient()->ip).to_string());
-            continue;
-        }
-
-        TC_LOG_DEBUG("server.rest", "Accepted connection from IP={}", boost::asio::ip::address_v4(soapClient->GetClient()->ip).to_string());
-
-        Trinity::Asio::post(*_ioContext, [soapClient]()
-        {
-            soapClient->GetClient()->user = (void*)&soapClient; // this allows us to make a copy of pointer inside GET/POST handlers to increment reference count
-            soap_begin(soapClient->GetClient());
-            soap_begin_recv(soapClient->GetClient());
-        });
+        _handshakeThreads->PostWork([this, soapClient]() { HandleSslHandshake(soapClient); });
     }
 
     // and release the context handle here - soap does not own it so it should not free it on exit
@@ -212,6 +236,25 @@ void LoginRESTService::Run()
     TC_LOG_INFO("server.rest", "Login service exiting...");
 }
 
+void LoginRESTService::HandleSslHandshake(std::shared_ptr<AsyncRequest> soapClient)
+{
+    if (soap_ssl_accept(soapClient->GetClient()) != SOAP_OK)
+    {
+        TC_LOG_DEBUG("server.rest", "Failed SSL handshake from IP={}", boost::asio::ip::address_v4(soapClient->GetClient()->ip).to_string());
+        return;
+    }
+
+    TC_LOG_DEBUG("server.rest", "Accepted connection from IP={}{}", boost::asio::ip::address_v4(soapClient->GetClient()->ip).to_string(),
+        SSL_session_reused(soapClient->GetClient()->ssl) ? " (resumed TLS session)" : "");
+
+    Trinity::Asio::post(*_ioContext, [soapClient]()
+    {
+        soapClient->GetClient()->user = (void*)&soapClient; // this allows us to make a copy of pointer inside GET/POST handlers to increment reference count
+        soap_begin(soapClient->GetClient());
+        soap_begin_recv(soapClient->GetClient());
+    });
+}
+
 int32 LoginRESTService::HandleHttpRequest(soap* soapClient, char const* method, HttpMethodHandlerMap const& handlers)
 {
     TC_LOG_DEBUG("server.rest", "[{}:{}] Handling {} request path=\"{}\"",
@@ -335,11 +378,42 @@ int32 LoginRESTService::HandlePostLogin(std::shared_ptr<AsyncRequest> request)
     Utf8ToUpperOnlyLatin(login);
     Utf8ToUpperOnlyLatin(password);
 
+    if (!IsLoginAttemptAllowed(request->GetClient()->ip))
+    {
+        TC_LOG_DEBUG("server.rest", "[{}, Account {}] Too many login attempts, rejecting", boost::asio::ip::address_v4(request->GetClient()->ip).to_string(), login);
+        return 429;
+    }
+
+    // reject early instead of queueing unbounded work when hashing can't keep up (mass reconnect, credential stuffing)
+    uint32 queueSize = ++_passwordHashQueueSize;
+    TC_METRIC_VALUE("login_password_hash_queue", queueSize);
+    if (queueSize > _passwordHashQueueMaxSize)
+    {
+        --_passwordHashQueueSize;
+        TC_LOG_DEBUG("server.rest", "[{}, Account {}] Password hash queue is full, rejecting", boost::asio::ip::address_v4(request->GetClient()->ip).to_string(), login);
+        return 503;
+    }
+
+    _passwordHashThreads->PostWork([this, request, login = std::move(login), password = std::move(password), queuedAt = std::chrono::steady_clock::now()]() mutable
+    {
+        std::string sentPasswordHash = CalculateShaPassHash(login, password);
+        --_passwordHashQueueSize;
+        TC_METRIC_VALUE("login_password_hash_time", std::chrono::steady_clock::now() - queuedAt);
+
+        Trinity::Asio::post(*_ioContext, [this, request, login = std::move(login), sentPasswordHash = std::move(sentPasswordHash)]()
+        {
+            CheckLoginCredentials(request, login, sentPasswordHash);
+        });
+    });
+
+    return SOAP_OK;
+}
+
+void LoginRESTService::CheckLoginCredentials(std::shared_ptr<AsyncRequest> request, std::string const& login, std::string const& sentPasswordHash)
+{
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_AUTHENTICATION);
     stmt->setString(0, login);
 
-    std::string sentPasswordHash = CalculateShaPassHash(login, password);
-
     request->SetCallback(std::make_unique<QueryCallback>(LoginDatabase.AsyncQuery(stmt)
         .WithChainingPreparedCallback([request, login, sentPasswordHash, this](QueryCallback& callback, PreparedQueryResult result)
     {
@@ -429,8 +503,39 @@ int32 LoginRESTService::HandlePostLogin(std::shared_ptr<AsyncRequest> request)
     })));
 
     Trinity::Asio::post(*_ioContext, [this, request]() { HandleAsyncRequest(request); });
+}
 
-    return SOAP_OK;
+bool LoginRESTService::IsLoginAttemptAllowed(uint32 ip)
+{
+    if (!_maxLoginAttemptsPerIp)
+        return true;
+
+    TimePoint now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(_loginAttemptsLock);
+
+    // forget addresses that were quiet for a whole window so the map does not grow with every address ever seen
+    if (now - _loginAttemptsCleanupTime >= LoginAttemptsWindow)
+    {
+        for (auto itr = _loginAttempts.begin(); itr != _loginAttempts.end();)
+        {
+            if (now - itr->second.WindowStart >= LoginAttemptsWindow)
+                itr = _loginAttempts.erase(itr);
+            else
+                ++itr;
+        }
+
+        _loginAttemptsCleanupTime = now;
+    }
+
+    LoginAttempts& attempts = _loginAttempts[ip];
+    if (now - attempts.WindowStart >= LoginAttemptsWindow)
+    {
+        attempts.WindowStart = now;
+        attempts.Count = 0;
+    }
+
+    return ++attempts.Count <= _maxLoginAttemptsPerIp;
 }
 
 int32 LoginRESTService::HandlePostRefreshLoginTicket(std::shared_ptr<AsyncRequest> request)
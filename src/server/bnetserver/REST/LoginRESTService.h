@@ -19,13 +19,22 @@
 #define LoginRESTService_h__
 
 #include "Define.h"
+#include "Duration.h"
 #include "IoContext.h"
 #include "IpAddress.h"
 #include "Login.pb.h"
 #include "Session.h"
 #include <boost/asio/ip/tcp.hpp>
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
+
+namespace Trinity
+{
+class ThreadPool;
+}
 
 class AsyncRequest;
 struct soap;
@@ -40,7 +49,8 @@ enum class BanMode
 class LoginRESTService
 {
 public:
-    LoginRESTService() : _ioContext(nullptr), _stopped(false), _port(0), _loginTicketDuration(0) { }
+    LoginRESTService();
+    ~LoginRESTService();
 
     static LoginRESTService& Instance();
 
@@ -52,6 +62,7 @@ public:
 
 private:
     void Run();
+    void HandleSslHandshake(std::shared_ptr<AsyncRequest> soapClient);
 
     friend int32 handle_get_plugin(soap* soapClient);
     friend int32 handle_post_plugin(soap* soapClient);
@@ -66,6 +77,9 @@ private:
     int32 HandlePostLogin(std::shared_ptr<AsyncRequest> request);
     int32 HandlePostRefreshLoginTicket(std::shared_ptr<AsyncRequest> request);
 
+    void CheckLoginCredentials(std::shared_ptr<AsyncRequest> request, std::string const& login, std::string const& sentPasswordHash);
+    bool IsLoginAttemptAllowed(uint32 ip);
+
     int32 SendResponse(soap* soapClient, google::protobuf::Message const& response);
 
     void HandleAsyncRequest(std::shared_ptr<AsyncRequest> request);
@@ -99,6 +113,7 @@ private:
 
     Trinity::Asio::IoContext* _ioContext;
     std::thread _thread;
+    std::unique_ptr<Trinity::ThreadPool> _handshakeThreads;
     std::atomic<bool> _stopped;
     Battlenet::JSON::Login::FormInputs _formInputs;
     std::string _bindIP;
@@ -109,6 +124,23 @@ private:
 
     HttpMethodHandlerMap _getHandlers;
     HttpMethodHandlerMap _postHandlers;
+
+    std::unique_ptr<Trinity::ThreadPool> _passwordHashThreads;
+    std::atomic<uint32> _passwordHashQueueSize;
+    uint32 _passwordHashQueueMaxSize;
+
+    struct LoginAttempts
+    {
+        TimePoint WindowStart;
+        uint32 Count = 0;
+    };
+
+    static constexpr Minutes LoginAttemptsWindow = Minutes(1);
+
+    uint32 _maxLoginAttemptsPerIp;
+    std::mutex _loginAttemptsLock;
+    std::unordered_map<uint32, LoginAttempts> _loginAttempts;
+    TimePoint _loginAttemptsCleanupTime;
 };
 
 #define sLoginService LoginRESTService::Instance()
@@ -39,6 +39,14 @@ bool Battlenet::SslContext::Initialize()
 
 #undef LOAD_CHECK
 
+    // let returning clients (launcher reconnecting, login storms after restart) resume sessions instead of doing a full key exchange
+    static constexpr unsigned char SessionIdContext[] = "bnetserver";
+    SSL_CTX* ctx = instance().native_handle();
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_set_session_id_context(ctx, SessionIdContext, sizeof(SessionIdContext) - 1);
+    SSL_CTX_sess_set_cache_size(ctx, sConfigMgr->GetIntDefault("SslSessionCacheSize", 20480));
+    SSL_CTX_set_timeout(ctx, sConfigMgr->GetIntDefault("SslSessionTimeout", 3600));
+
     return true;
 }
 
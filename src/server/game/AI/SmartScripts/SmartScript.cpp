@@ -67,6 +67,7 @@ SmartScript::SmartScript()
     mEventSortingRequired = false;
     mNestedEventsCounter = 0;
     mAllEventFlags = 0;
+    mEventIndexOffsets.fill(0);
 }
 
 SmartScript::~SmartScript()
@@ -248,15 +249,19 @@ void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint3
     }
     else
     {
-        for (SmartScriptHolder& event : mEvents)
+        if (e < SMART_EVENT_END && e != SMART_EVENT_LINK) //special handling
         {
-            SMART_EVENT eventType = SMART_EVENT(event.GetEventType());
-            if (eventType == SMART_EVENT_LINK)//special handling
-                continue;
-
-            if (eventType == e)
+            for (uint32 i = mEventIndexOffsets[e]; i < mEventIndexOffsets[e + 1]; ++i)
+            {
+                uint32 index = mEventIndex[i];
+                SmartScriptHolder& event = mEvents[index];
                 if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
+                {
                     ProcessEvent(event, unit, var0, var1, bvar, spell, gob, varString);
+                    if (!event.active)
+                        ScheduleCooldown(index);
+                }
+            }
         }
     }
 
@@ -3652,44 +3657,27 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
 
         e.active = true;//activate events with cooldown
 
-        switch (e.GetEventType())//process ONLY timed events
-        {
-            case SMART_EVENT_UPDATE:
-            case SMART_EVENT_UPDATE_OOC:
-            case SMART_EVENT_UPDATE_IC:
-            case SMART_EVENT_HEALTH_PCT:
-            case SMART_EVENT_MANA_PCT:
-            case SMART_EVENT_RANGE:
-            case SMART_EVENT_VICTIM_CASTING:
-            case SMART_EVENT_FRIENDLY_IS_CC:
-            case SMART_EVENT_FRIENDLY_MISSING_BUFF:
-            case SMART_EVENT_HAS_AURA:
-            case SMART_EVENT_TARGET_BUFFED:
-            case SMART_EVENT_FRIENDLY_HEALTH_PCT:
-            case SMART_EVENT_DISTANCE_CREATURE:
-            case SMART_EVENT_DISTANCE_GAMEOBJECT:
-            {
-                if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+        if (IsTimedEventType(e.GetEventType()))//process ONLY timed events
+        {
+            if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+            {
+                Unit* invoker = nullptr;
+                if (me && !mTimedActionListInvoker.IsEmpty())
+                    invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
+                ProcessEvent(e, invoker);
+                e.enableTimed = false;//disable event if it is in an ActionList and was processed once
+                for (SmartScriptHolder& scriptholder : mTimedActionList)
                 {
-                    Unit* invoker = nullptr;
-                    if (me && !mTimedActionListInvoker.IsEmpty())
-                        invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
-                    ProcessEvent(e, invoker);
-                    e.enableTimed = false;//disable event if it is in an ActionList and was processed once
-                    for (SmartScriptHolder& scriptholder : mTimedActionList)
+                    //find the first event which is not the current one and enable it
+                    if (scriptholder.event_id > e.event_id)
                     {
-                        //find the first event which is not the current one and enable it
-                        if (scriptholder.event_id > e.event_id)
-                        {
-                            scriptholder.enableTimed = true;
-                            break;
-                        }
+                        scriptholder.enableTimed = true;
+                        break;
                     }
                 }
-                else
-                    ProcessEvent(e);
-                break;
             }
+            else
+                ProcessEvent(e);
         }
 
         if (e.priority != SmartScriptHolder::DEFAULT_PRIORITY)
@@ -3708,6 +3696,30 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
         e.timer -= diff;
 }
 
+bool SmartScript::IsTimedEventType(uint32 eventType)
+{
+    switch (eventType)
+    {
+        case SMART_EVENT_UPDATE:
+        case SMART_EVENT_UPDATE_OOC:
+        case SMART_EVENT_UPDATE_IC:
+        case SMART_EVENT_HEALTH_PCT:
+        case SMART_EVENT_MANA_PCT:
+        case SMART_EVENT_RANGE:
+        case SMART_EVENT_VICTIM_CASTING:
+        case SMART_EVENT_FRIENDLY_IS_CC:
+        case SMART_EVENT_FRIENDLY_MISSING_BUFF:
+        case SMART_EVENT_HAS_AURA:
+        case SMART_EVENT_TARGET_BUFFED:
+        case SMART_EVENT_FRIENDLY_HEALTH_PCT:
+        case SMART_EVENT_DISTANCE_CREATURE:
+        case SMART_EVENT_DISTANCE_GAMEOBJECT:
+            return true;
+        default:
+            return false;
+    }
+}
+
 bool SmartScript::CheckTimer(SmartScriptHolder const& e) const
 {
     return e.active;
@@ -3721,9 +3733,52 @@ void SmartScript::InstallEvents()
             mEvents.push_back(installevent);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
+void SmartScript::BuildEventIndex()
+{
+    // counting sort of event positions by type, stable so events of one type stay in priority order
+    mEventIndexOffsets.fill(0);
+    for (SmartScriptHolder const& e : mEvents)
+        if (e.GetEventType() < SMART_EVENT_END)
+            ++mEventIndexOffsets[e.GetEventType() + 1];
+
+    for (uint32 type = 1; type <= SMART_EVENT_END; ++type)
+        mEventIndexOffsets[type] += mEventIndexOffsets[type - 1];
+
+    std::array<uint32, SMART_EVENT_END + 1> next = mEventIndexOffsets;
+    mEventIndex.resize(mEventIndexOffsets[SMART_EVENT_END]);
+    mTimedEventIndex.clear();
+    mCooldownEventIndex.clear();
+    for (uint32 index = 0; index < mEvents.size(); ++index)
+    {
+        SmartScriptHolder const& e = mEvents[index];
+        uint32 type = e.GetEventType();
+        if (type >= SMART_EVENT_END)
+            continue;
+
+        mEventIndex[next[type]++] = index;
+        if (type == SMART_EVENT_LINK)
+            continue;
+
+        if (IsTimedEventType(type))
+            mTimedEventIndex.push_back(index);
+        else if (!e.active)
+            mCooldownEventIndex.push_back(index);
+    }
+}
+
+void SmartScript::ScheduleCooldown(uint32 index)
+{
+    if (IsTimedEventType(mEvents[index].GetEventType()))
+        return;
+
+    if (std::find(mCooldownEventIndex.begin(), mCooldownEventIndex.end(), index) == mCooldownEventIndex.end())
+        mCooldownEventIndex.push_back(index);
+}
+
 void SmartScript::RemoveStoredEvent(uint32 id)
 {
     if (!mStoredEvents.empty())
@@ -3824,11 +3879,21 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        BuildEventIndex();
         mEventSortingRequired = false;
     }
 
-    for (SmartScriptHolder& mEvent : mEvents)
-        UpdateTimer(mEvent, diff);
+    // events with nothing left to do until triggered again are not updated, an event only needs its cooldown to expire
+    Trinity::Containers::EraseIf(mCooldownEventIndex, [this, diff](uint32 index)
+    {
+        SmartScriptHolder& e = mEvents[index];
+        if (!e.active)
+            UpdateTimer(e, diff);
+        return e.active;
+    });
+
+    for (uint32 index : mTimedEventIndex)
+        UpdateTimer(mEvents[index], diff);
 
     if (!mStoredEvents.empty())
     {
@@ -3911,7 +3976,7 @@ void SmartScript::RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll)
     e.runOnce = false;
 }
 
-void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEntry const* at, SceneTemplate const* scene, Quest const* quest, uint32 event)
+void SmartScript::FillScript(SmartAIEventList const& e, WorldObject* obj, AreaTriggerEntry const* at, SceneTemplate const* scene, Quest const* quest, uint32 event)
 {
     if (e.empty())
     {
@@ -3927,7 +3992,7 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEn
             TC_LOG_DEBUG("scripts.ai", "SmartScript: EventMap for Event {} is empty but is using SmartScript.", event);
         return;
     }
-    for (SmartScriptHolder& scriptholder : e)
+    for (SmartScriptHolder const& scriptholder : e)
     {
         #ifndef TRINITY_DEBUG
             if (scriptholder.event.event_flags & SMART_EVENT_FLAG_DEBUG_ONLY)
@@ -3957,43 +4022,40 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEn
 
 void SmartScript::GetScript()
 {
-    SmartAIEventList e;
-
     // We must use script type to avoid ambiguities
     switch (mScriptType)
     {
         case SMART_SCRIPT_TYPE_CREATURE:
-            e = sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
-            if (e.empty())
-                e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
-            FillScript(std::move(e), me, nullptr, nullptr, nullptr, 0);
+        {
+            SmartAIEventList const* e = &sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
+            if (e->empty())
+                e = &sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
+            FillScript(*e, me, nullptr, nullptr, nullptr, 0);
             break;
+        }
         case SMART_SCRIPT_TYPE_GAMEOBJECT:
-            e = sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
-            if (e.empty())
-                e = sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
-            FillScript(std::move(e), go, nullptr, nullptr, nullptr, 0);
+        {
+            SmartAIEventList const* e = &sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
+            if (e->empty())
+                e = &sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
+            FillScript(*e, go, nullptr, nullptr, nullptr, 0);
             break;
+        }
         case SMART_SCRIPT_TYPE_AREATRIGGER_ENTITY:
         case SMART_SCRIPT_TYPE_AREATRIGGER_ENTITY_CUSTOM:
-            e = sSmartScriptMgr->GetScript((int32)areaTrigger->GetEntry(), mScriptType);
-            FillScript(std::move(e), areaTrigger, nullptr, nullptr, nullptr, 0);
+            FillScript(sSmartScriptMgr->GetScript((int32)areaTrigger->GetEntry(), mScriptType), areaTrigger, nullptr, nullptr, nullptr, 0);
             break;
         case SMART_SCRIPT_TYPE_AREATRIGGER:
-            e = sSmartScriptMgr->GetScript((int32)trigger->ID, mScriptType);
-            FillScript(std::move(e), nullptr, trigger, nullptr, nullptr, 0);
+            FillScript(sSmartScriptMgr->GetScript((int32)trigger->ID, mScriptType), nullptr, trigger, nullptr, nullptr, 0);
             break;
         case SMART_SCRIPT_TYPE_SCENE:
-            e = sSmartScriptMgr->GetScript(sceneTemplate->SceneId, mScriptType);
-            FillScript(std::move(e), nullptr, nullptr, sceneTemplate, nullptr, 0);
+            FillScript(sSmartScriptMgr->GetScript(sceneTemplate->SceneId, mScriptType), nullptr, nullptr, sceneTemplate, nullptr, 0);
             break;
         case SMART_SCRIPT_TYPE_QUEST:
-            e = sSmartScriptMgr->GetScript(quest->GetQuestId(), mScriptType);
-            FillScript(std::move(e), nullptr, nullptr, nullptr, quest, 0);
+            FillScript(sSmartScriptMgr->GetScript(quest->GetQuestId(), mScriptType), nullptr, nullptr, nullptr, quest, 0);
             break;
         case SMART_SCRIPT_TYPE_EVENT:
-            e = sSmartScriptMgr->GetScript((int32)event, mScriptType);
-            FillScript(std::move(e), nullptr, nullptr, nullptr, nullptr, event);
+            FillScript(sSmartScriptMgr->GetScript((int32)event, mScriptType), nullptr, nullptr, nullptr, nullptr, event);
             break;
         default:
             break;
@@ -4105,6 +4167,8 @@ void SmartScript::OnInitialize(WorldObject* obj, AreaTriggerEntry const* at, Sce
     for (SmartScriptHolder& event : mEvents)
         InitTimer(event);//calculate timers for first time use
 
+    BuildEventIndex();
+
     ProcessEventsFor(SMART_EVENT_AI_INIT);
     InstallEvents();
     ProcessEventsFor(SMART_EVENT_JUST_CREATED);
@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "SmartScriptMgr.h"
+#include <array>
 
 class AreaTrigger;
 class Creature;
@@ -40,7 +41,7 @@ class TC_GAME_API SmartScript
 
         void OnInitialize(WorldObject* obj, AreaTriggerEntry const* at = nullptr, SceneTemplate const* scene = nullptr, Quest const* qst = nullptr, uint32 evnt = 0);
         void GetScript();
-        void FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEntry const* at, SceneTemplate const* scene, Quest const* quest, uint32 event = 0);
+        void FillScript(SmartAIEventList const& e, WorldObject* obj, AreaTriggerEntry const* at, SceneTemplate const* scene, Quest const* quest, uint32 event = 0);
 
         void ProcessEventsFor(SMART_EVENT e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr, std::string const& varString = "");
         void ProcessEvent(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr, std::string const& varString = "");
@@ -105,10 +106,20 @@ class TC_GAME_API SmartScript
         bool IsInPhase(uint32 p) const;
 
         void SortEvents(SmartAIEventList& events);
+        void BuildEventIndex();
+        void ScheduleCooldown(uint32 index);
+        static bool IsTimedEventType(uint32 eventType);
         void RaisePriority(SmartScriptHolder& e);
         void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
         SmartAIEventList mEvents;
+        // positions in mEvents grouped by event type (keeping mEvents order within a type), rebuilt whenever mEvents is sorted or grows
+        std::vector<uint32> mEventIndex;
+        std::array<uint32, SMART_EVENT_END + 1> mEventIndexOffsets;
+        // positions in mEvents of periodic events, updated every tick
+        std::vector<uint32> mTimedEventIndex;
+        // positions in mEvents of other events waiting for their cooldown to expire, only these need timer updates
+        std::vector<uint32> mCooldownEventIndex;
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         ObjectGuid mTimedActionListInvoker;
@@ -1713,7 +1713,8 @@ class TC_GAME_API SmartAIMgr
 
         void LoadSmartAIFromDB();
 
-        SmartAIEventList GetScript(int32 entry, SmartScriptType type);
+        // returned list is owned by manager, callers copy only the events they use
+        SmartAIEventList const& GetScript(int32 entry, SmartScriptType type) const;
 
         static SmartScriptHolder& FindLinkedSourceEvent(SmartAIEventList& list, uint32 eventId);
 
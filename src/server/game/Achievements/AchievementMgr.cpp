@@ -203,7 +203,7 @@ bool AchievementMgr::RequiredAchievementSatisfied(uint32 achievementId) const
     return HasAchieved(achievementId);
 }
 
-PlayerAchievementMgr::PlayerAchievementMgr(Player* owner) : _owner(owner)
+PlayerAchievementMgr::PlayerAchievementMgr(Player* owner) : _owner(owner), _openCriteriaPruneNeeded(false)
 {
 }
 
@@ -220,6 +220,7 @@ void PlayerAchievementMgr::Reset()
 
     _completedAchievements.clear();
     _achievementPoints = 0;
+    _openCriteria.clear();
     DeleteFromDB(_owner->GetGUID());
 
     // re-fill data
@@ -243,6 +244,8 @@ void PlayerAchievementMgr::DeleteFromDB(ObjectGuid const& guid)
 
 void PlayerAchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, PreparedQueryResult criteriaResult)
 {
+    _openCriteria.clear();
+
     if (achievementResult)
     {
         do
@@ -483,6 +486,9 @@ void PlayerAchievementMgr::CompletedAchievement(AchievementEntry const* achievem
     ca.Date = GameTime::GetGameTime();
     ca.Changed = true;
 
+    // criteria lists may be iterated by UpdateCriteria right now, drop the completed criteria on next player update
+    _openCriteriaPruneNeeded = true;
+
     if (achievement->Flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
         sAchievementMgr->SetRealmCompleted(achievement);
 
@@ -671,7 +677,38 @@ void PlayerAchievementMgr::SendPacket(WorldPacket const* data) const
 
 CriteriaList const& PlayerAchievementMgr::GetCriteriaByType(CriteriaType type, uint32 asset) const
 {
-    return sCriteriaMgr->GetPlayerCriteriaByType(type, asset);
+    CriteriaList const& criteriaList = sCriteriaMgr->GetPlayerCriteriaByType(type, asset);
+    if (criteriaList.empty())
+        return criteriaList;
+
+    auto [itr, inserted] = _openCriteria.try_emplace(&criteriaList);
+    if (inserted)
+        std::copy_if(criteriaList.begin(), criteriaList.end(), std::back_inserter(itr->second), [this](Criteria const* criteria) { return IsOpenCriteria(criteria); });
+
+    return itr->second;
+}
+
+bool PlayerAchievementMgr::IsOpenCriteria(Criteria const* criteria) const
+{
+    CriteriaTreeList const* trees = sCriteriaMgr->GetCriteriaTreesByCriteria(criteria->ID);
+    if (!trees)
+        return true;
+
+    // counters are never earned so they stay open
+    return std::any_of(trees->begin(), trees->end(), [this](CriteriaTree const* tree)
+    {
+        return !tree->Achievement || !HasAchieved(tree->Achievement->ID);
+    });
+}
+
+void PlayerAchievementMgr::PruneOpenCriteria()
+{
+    if (!_openCriteriaPruneNeeded)
+        return;
+
+    _openCriteriaPruneNeeded = false;
+    for (auto& [criteriaList, openCriteria] : _openCriteria)
+        Trinity::Containers::EraseIf(openCriteria, [this](Criteria const* criteria) { return !IsOpenCriteria(criteria); });
 }
 
 GuildAchievementMgr::GuildAchievementMgr(Guild* owner) : _owner(owner)
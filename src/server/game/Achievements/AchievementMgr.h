@@ -93,6 +93,8 @@ public:
     using CriteriaHandler::ModifierTreeSatisfied;
     bool ModifierTreeSatisfied(uint32 modifierTreeId) const;
 
+    void PruneOpenCriteria();
+
 protected:
     void SendCriteriaUpdate(Criteria const* entry, CriteriaProgress const* progress, Seconds timeElapsed, bool timedCompleted) const override;
     void SendCriteriaProgressRemoved(uint32 criteriaId) override;
@@ -105,7 +107,13 @@ protected:
     CriteriaList const& GetCriteriaByType(CriteriaType type, uint32 asset) const override;
 
 private:
+    bool IsOpenCriteria(Criteria const* criteria) const;
+
     Player* _owner;
+
+    // criteria lists of CriteriaMgr::GetPlayerCriteriaByType filtered to criteria that are still part of an achievement not yet earned
+    mutable std::unordered_map<CriteriaList const*, CriteriaList> _openCriteria;
+    bool _openCriteriaPruneNeeded;
 };
 
 class TC_GAME_API GuildAchievementMgr : public AchievementMgr
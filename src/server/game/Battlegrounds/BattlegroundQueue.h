@@ -47,6 +47,9 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  ArenaMatchmakerRating;                          // if rated match, inited to the rating of the team
     uint32  OpponentsTeamRating;                            // for rated arena matches
     uint32  OpponentsMatchmakerRating;                      // for rated arena matches
+    BattlegroundBracketId BracketId;                        // bracket of m_QueuedGroups holding this group
+    uint32  QueueType;                                      // BattlegroundQueueGroupTypes list of m_QueuedGroups holding this group
+    std::list<GroupQueueInfo*>::iterator QueuePosition;     // position in that list, lets the group be removed or moved without searching the queues
 };
 
 enum BattlegroundQueueGroupTypes
@@ -128,10 +131,14 @@ class TC_GAME_API BattlegroundQueue
         BattlegroundQueueTypeId m_queueId;
 
         bool InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, Team side);
+        void MoveGroupToQueue(GroupQueueInfo* ginfo, uint32 queueType);
         uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
         uint32 m_WaitTimeLastPlayer[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
         uint32 m_SumOfWaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
+        // players of groups that are not invited yet, kept up to date on every queue change so updates don't have to walk the lists to count them
+        uint32 m_WaitingPlayers[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT];
+
         // Event handler
         EventProcessor m_events;
 };
@@ -212,6 +212,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
 
     PlayerInfo& playerInfo = _playersStore[guid];
     playerInfo.SetInvisible(!player->isGMVisible());
+    playerInfo.SetPlayer(player);
 
     /*
     YouJoinedAppend appender;
@@ -986,7 +987,7 @@ void Channel::SendToAll(Builder& builder, ObjectGuid const& guid, ObjectGuid con
     Trinity::LocalizedDo<Builder> localizer(builder);
 
     for (PlayerContainer::value_type const& i : _playersStore)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
+        if (Player* player = i.second.GetPlayer())
             if (guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid))
                 localizer(player);
 }
@@ -998,7 +999,7 @@ void Channel::SendToAllButOne(Builder& builder, ObjectGuid const& who) const
 
     for (PlayerContainer::value_type const& i : _playersStore)
         if (i.first != who)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
+            if (Player* player = i.second.GetPlayer())
                 localizer(player);
 }
 
@@ -1018,7 +1019,7 @@ void Channel::SendToAllWithAddon(Builder& builder, std::string const& addonPrefi
     Trinity::LocalizedDo<Builder> localizer(builder);
 
     for (PlayerContainer::value_type const& i : _playersStore)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
+        if (Player* player = i.second.GetPlayer())
             if (player->GetSession()->IsAddonRegistered(addonPrefix) && (guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid)))
                 localizer(player);
 }
@@ -167,9 +167,14 @@ class TC_GAME_API Channel
                 RemoveFlag(MEMBER_FLAG_MUTED);
         }
 
+        // members leave all channels on logout, before Player is deleted
+        Player* GetPlayer() const { return _player; }
+        void SetPlayer(Player* player) { _player = player; }
+
     private:
         uint8 _flags = MEMBER_FLAG_NONE;
         bool _invisible = false;
+        Player* _player = nullptr;
     };
 
     public:
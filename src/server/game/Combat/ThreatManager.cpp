@@ -27,23 +27,16 @@
 #include "SpellAuraEffects.h"
 #include "SpellMgr.h"
 #include "TemporarySummon.h"
-#include <boost/heap/fibonacci_heap.hpp>
+#include <algorithm>
 
 const CompareThreatLessThan ThreatManager::CompareThreat;
 
-class ThreatManager::Heap : public boost::heap::fibonacci_heap<ThreatReference const*, boost::heap::compare<CompareThreatLessThan>>
-{
-};
-
 void ThreatReference::AddThreat(float amount)
 {
     if (amount == 0.0f)
         return;
     _baseAmount = std::max<float>(_baseAmount + amount, 0.0f);
-    if (amount > 0.0f)
-        HeapNotifyIncreased();
-    else
-        HeapNotifyDecreased();
+    ListNotifyChanged();
     _mgr._needClientUpdate = true;
 }
 
@@ -52,10 +45,7 @@ void ThreatReference::ScaleThreat(float factor)
     if (factor == 1.0f)
         return;
     _baseAmount *= factor;
-    if (factor > 1.0f)
-        HeapNotifyIncreased();
-    else
-        HeapNotifyDecreased();
+    ListNotifyChanged();
     _mgr._needClientUpdate = true;
 }
 
@@ -68,13 +58,13 @@ void ThreatReference::UpdateOffline()
     if (shouldBeOffline)
     {
         _online = ONLINE_STATE_OFFLINE;
-        HeapNotifyDecreased();
+        ListNotifyChanged();
         _mgr.SendRemoveToClients(_victim);
     }
     else
     {
         _online = ShouldBeSuppressed() ? ONLINE_STATE_SUPPRESSED : ONLINE_STATE_ONLINE;
-        HeapNotifyIncreased();
+        ListNotifyChanged();
         _mgr.RegisterForAIUpdate(GetVictim()->GetGUID());
     }
 }
@@ -131,10 +121,7 @@ void ThreatReference::UpdateTauntState(TauntState state)
 
     std::swap(state, _taunted);
 
-    if (_taunted < state)
-        HeapNotifyDecreased();
-    else
-        HeapNotifyIncreased();
+    ListNotifyChanged();
 
     _mgr._needClientUpdate = true;
 }
@@ -151,24 +138,6 @@ void ThreatReference::UnregisterAndFree()
     delete this;
 }
 
-class ThreatReferenceImpl : public ThreatReference
-{
-public:
-    explicit ThreatReferenceImpl(ThreatManager* mgr, Unit* victim) : ThreatReference(mgr, victim) { }
-
-    ThreatManager::Heap::handle_type _handle;
-};
-
-void ThreatReference::HeapNotifyIncreased()
-{
-    _mgr._sortedThreatList->increase(static_cast<ThreatReferenceImpl*>(this)->_handle);
-}
-
-void ThreatReference::HeapNotifyDecreased()
-{
-    _mgr._sortedThreatList->decrease(static_cast<ThreatReferenceImpl*>(this)->_handle);
-}
-
 /*static*/ bool ThreatManager::CanHaveThreatList(Unit const* who)
 {
     Creature const* cWho = who->ToCreature();
@@ -190,7 +159,7 @@ void ThreatReference::HeapNotifyDecreased()
 }
 
 ThreatManager::ThreatManager(Unit* owner) : _owner(owner), _ownerCanHaveThreatList(false), _needClientUpdate(false), _updateTimer(THREAT_UPDATE_INTERVAL),
-    _sortedThreatList(std::make_unique<Heap>()), _currentVictimRef(nullptr), _fixateRef(nullptr)
+    _sortedThreatListDirty(false), _currentVictimRef(nullptr), _fixateRef(nullptr)
 {
     for (int8 i = 0; i < MAX_SPELL_SCHOOL; ++i)
         _singleSchoolModifiers[i] = 1.0f;
@@ -199,7 +168,7 @@ ThreatManager::ThreatManager(Unit* owner) : _owner(owner), _ownerCanHaveThreatLi
 ThreatManager::~ThreatManager()
 {
     ASSERT(_myThreatListEntries.empty(), "ThreatManager::~ThreatManager - %s: we still have %zu things threatening us, one of them is %s.", _owner->GetGUID().ToString().c_str(), _myThreatListEntries.size(), _myThreatListEntries.begin()->first.ToString().c_str());
-    ASSERT(_sortedThreatList->empty(), "ThreatManager::~ThreatManager - %s: we still have %zu things threatening us, one of them is %s.", _owner->GetGUID().ToString().c_str(), _sortedThreatList->size(), (*_sortedThreatList->begin())->GetVictim()->GetGUID().ToString().c_str());
+    ASSERT(_sortedThreatList.empty(), "ThreatManager::~ThreatManager - %s: we still have %zu things threatening us, one of them is %s.", _owner->GetGUID().ToString().c_str(), _sortedThreatList.size(), _sortedThreatList.front()->GetVictim()->GetGUID().ToString().c_str());
     ASSERT(_threatenedByMe.empty(), "ThreatManager::~ThreatManager - %s: we are still threatening %zu things, one of them is %s.", _owner->GetGUID().ToString().c_str(), _threatenedByMe.size(), _threatenedByMe.begin()->first.ToString().c_str());
 }
 
@@ -238,7 +207,7 @@ Unit* ThreatManager::GetLastVictim() const
 
 Unit* ThreatManager::GetAnyTarget() const
 {
-    for (ThreatReference const* ref : *_sortedThreatList)
+    for (ThreatReference const* ref : _sortedThreatList)
         if (!ref->IsOffline())
             return ref->GetVictim();
     return nullptr;
@@ -247,8 +216,8 @@ Unit* ThreatManager::GetAnyTarget() const
 bool ThreatManager::IsThreatListEmpty(bool includeOffline) const
 {
     if (includeOffline)
-        return _sortedThreatList->empty();
-    for (ThreatReference const* ref : *_sortedThreatList)
+        return _sortedThreatList.empty();
+    for (ThreatReference const* ref : _sortedThreatList)
         if (ref->IsAvailable())
             return false;
     return true;
@@ -273,7 +242,7 @@ float ThreatManager::GetThreat(Unit const* who, bool includeOffline) const
 
 size_t ThreatManager::GetThreatListSize() const
 {
-    return _sortedThreatList->size();
+    return _sortedThreatList.size();
 }
 
 Trinity::IteratorPair<ThreatManager::ThreatListIterator, std::nullptr_t> ThreatManager::GetUnsortedThreatList() const
@@ -292,24 +261,24 @@ Trinity::IteratorPair<ThreatManager::ThreatListIterator, std::nullptr_t> ThreatM
 
 Trinity::IteratorPair<ThreatManager::ThreatListIterator, std::nullptr_t> ThreatManager::GetSortedThreatList() const
 {
-    auto itr = _sortedThreatList->ordered_begin();
-    auto end = _sortedThreatList->ordered_end();
-    std::function<ThreatReference const* ()> generator = [itr, end]() mutable -> ThreatReference const*
+    SortThreatList();
+    std::function<ThreatReference const* ()> generator = [list = &_sortedThreatList, index = size_t(0)]() mutable -> ThreatReference const*
     {
-        if (itr == end)
+        if (index >= list->size())
             return nullptr;
 
-        return *(itr++);
+        return (*list)[index++];
     };
     return { ThreatListIterator{ std::move(generator) }, nullptr };
 }
 
 std::vector<ThreatReference*> ThreatManager::GetModifiableThreatList()
 {
+    SortThreatList();
     std::vector<ThreatReference*> list;
-    list.reserve(_myThreatListEntries.size());
-    for (auto it = _sortedThreatList->ordered_begin(), end = _sortedThreatList->ordered_end(); it != end; ++it)
-        list.push_back(const_cast<ThreatReference*>(*it));
+    list.reserve(_sortedThreatList.size());
+    for (ThreatReference const* ref : _sortedThreatList)
+        list.push_back(const_cast<ThreatReference*>(ref));
     return list;
 }
 
@@ -340,12 +309,12 @@ void ThreatManager::EvaluateSuppressed(bool canExpire)
         if (pair.second->IsOnline() && shouldBeSuppressed)
         {
             pair.second->_online = ThreatReference::ONLINE_STATE_SUPPRESSED;
-            pair.second->HeapNotifyDecreased();
+            pair.second->ListNotifyChanged();
         }
         else if (canExpire && pair.second->IsSuppressed() && !shouldBeSuppressed)
         {
             pair.second->_online = ThreatReference::ONLINE_STATE_ONLINE;
-            pair.second->HeapNotifyIncreased();
+            pair.second->ListNotifyChanged();
         }
     }
 }
@@ -441,7 +410,7 @@ void ThreatManager::AddThreat(Unit* target, float amount, SpellInfo const* spell
             if (!ref->ShouldBeSuppressed())
             {
                 ref->_online = ThreatReference::ONLINE_STATE_ONLINE;
-                ref->HeapNotifyIncreased();
+                ref->ListNotifyChanged();
             }
 
         if (ref->IsOnline())
@@ -450,7 +419,7 @@ void ThreatManager::AddThreat(Unit* target, float amount, SpellInfo const* spell
     }
 
     // ok, we're now in combat - create the threat list reference and push it to the respective managers
-    ThreatReference* ref = new ThreatReferenceImpl(this, target);
+    ThreatReference* ref = new ThreatReference(this, target);
     PutThreatListRef(target->GetGUID(), ref);
     target->GetThreatManager().PutThreatenedByMeRef(_owner->GetGUID(), ref);
 
@@ -473,10 +442,11 @@ void ThreatManager::ScaleThreat(Unit* target, float factor)
 
 void ThreatManager::MatchUnitThreatToHighestThreat(Unit* target)
 {
-    if (_sortedThreatList->empty())
+    if (_sortedThreatList.empty())
         return;
 
-    auto it = _sortedThreatList->ordered_begin(), end = _sortedThreatList->ordered_end();
+    SortThreatList();
+    auto it = _sortedThreatList.begin(), end = _sortedThreatList.end();
     ThreatReference const* highest = *it;
     if (!highest->IsAvailable())
         return;
@@ -585,7 +555,7 @@ void ThreatManager::UpdateVictim()
 
 ThreatReference const* ThreatManager::ReselectVictim()
 {
-    if (_sortedThreatList->empty())
+    if (_sortedThreatList.empty())
         return nullptr;
 
     for (auto const& pair : _myThreatListEntries)
@@ -599,7 +569,7 @@ ThreatReference const* ThreatManager::ReselectVictim()
     if (oldVictimRef && oldVictimRef->IsOffline())
         oldVictimRef = nullptr;
     // in 99% of cases - we won't need to actually look at anything beyond the first element
-    ThreatReference const* highest = _sortedThreatList->top();
+    ThreatReference const* highest = GetHighestThreatRef();
     // if the highest reference is offline, the entire list is offline, and we indicate this
     if (!highest->IsAvailable())
         return nullptr;
@@ -616,8 +586,9 @@ ThreatReference const* ThreatManager::ReselectVictim()
     if (_owner->IsWithinMeleeRange(highest->_victim))
         return highest;
     // If we get here, highest threat is ranged, but below 130% of current - there might be a melee that breaks 110% below us somewhere, so now we need to actually look at the next highest element
-    // luckily, this is a heap, so getting the next highest element is O(log n), and we're just gonna do that repeatedly until we've seen enough targets (or find a target)
-    auto it = _sortedThreatList->ordered_begin(), end = _sortedThreatList->ordered_end();
+    // this is the only case where selection needs more than the highest element, so this is where we pay for sorting the list
+    SortThreatList();
+    auto it = _sortedThreatList.begin(), end = _sortedThreatList.end();
     while (it != end)
     {
         ThreatReference const* next = *it;
@@ -638,6 +609,30 @@ ThreatReference const* ThreatManager::ReselectVictim()
     return nullptr;
 }
 
+void ThreatManager::SortThreatList() const
+{
+    if (!_sortedThreatListDirty)
+        return;
+
+    std::sort(_sortedThreatList.begin(), _sortedThreatList.end(), [](ThreatReference const* a, ThreatReference const* b)
+    {
+        return ThreatManager::CompareReferencesLT(b, a, 1.0f);
+    });
+    _sortedThreatListDirty = false;
+}
+
+ThreatReference const* ThreatManager::GetHighestThreatRef() const
+{
+    if (_sortedThreatList.empty())
+        return nullptr;
+
+    // a linear scan is cheaper than sorting when only the top entry is needed
+    if (_sortedThreatListDirty)
+        return *std::max_element(_sortedThreatList.begin(), _sortedThreatList.end(), CompareThreat);
+
+    return _sortedThreatList.front();
+}
+
 void ThreatManager::ProcessAIUpdates()
 {
     CreatureAI* ai = ASSERT_NOTNULL(_owner->ToCreature())->AI();
@@ -758,19 +753,11 @@ void ThreatManager::UpdateMyTempModifiers()
     for (AuraEffect const* eff : _owner->GetAuraEffectsByType(SPELL_AURA_MOD_TOTAL_THREAT))
         mod += eff->GetAmount();
 
-    if (_threatenedByMe.empty())
-        return;
-
-    auto it = _threatenedByMe.begin();
-    bool const isIncrease = (it->second->_tempModifier < mod);
-    do
+    for (auto const& pair : _threatenedByMe)
     {
-        it->second->_tempModifier = mod;
-        if (isIncrease)
-            it->second->HeapNotifyIncreased();
-        else
-            it->second->HeapNotifyDecreased();
-    } while ((++it) != _threatenedByMe.end());
+        pair.second->_tempModifier = mod;
+        pair.second->ListNotifyChanged();
+    }
 }
 
 void ThreatManager::UpdateMySpellSchoolModifiers()
@@ -828,8 +815,8 @@ void ThreatManager::SendThreatListToClients(bool newHighest) const
     auto fillSharedPacketDataAndSend = [&](auto& packet)
     {
         packet.UnitGUID = _owner->GetGUID();
-        packet.ThreatList.reserve(_sortedThreatList->size());
-        for (ThreatReference const* ref : *_sortedThreatList)
+        packet.ThreatList.reserve(_sortedThreatList.size());
+        for (ThreatReference const* ref : _sortedThreatList)
         {
             if (!ref->IsAvailable())
                 continue;
@@ -861,7 +848,8 @@ void ThreatManager::PutThreatListRef(ObjectGuid const& guid, ThreatReference* re
     auto& inMap = _myThreatListEntries[guid];
     ASSERT(!inMap, "Duplicate threat reference at %p being inserted on %s for %s - memory leak!", ref, _owner->GetGUID().ToString().c_str(), guid.ToString().c_str());
     inMap = ref;
-    static_cast<ThreatReferenceImpl*>(ref)->_handle = _sortedThreatList->push(ref);
+    _sortedThreatList.push_back(ref);
+    _sortedThreatListDirty = true;
 }
 
 void ThreatManager::PurgeThreatListRef(ObjectGuid const& guid)
@@ -871,7 +859,8 @@ void ThreatManager::PurgeThreatListRef(ObjectGuid const& guid)
         return;
     ThreatReference* ref = it->second;
     _myThreatListEntries.erase(it);
-    _sortedThreatList->erase(static_cast<ThreatReferenceImpl*>(ref)->_handle);
+    // erasing keeps the remaining entries in order, no need to sort again
+    _sortedThreatList.erase(std::find(_sortedThreatList.begin(), _sortedThreatList.end(), ref));
 
     if (_fixateRef == ref)
         _fixateRef = nullptr;
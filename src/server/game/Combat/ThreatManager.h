@@ -47,8 +47,8 @@ class SpellInfo;
  *  - Adding threat will also create a combat reference between the units if one doesn't exist yet (even if the owner can't have a threat list!)        *
  *  - Ending combat between two units will also delete any threat references that may exist between them.                                               *
  *                                                                                                                                                      *
- * To manage a creature's threat list, ThreatManager maintains a heap of threat reference const pointers.                                               *
- * This heap is kept well-structured in all methods that modify ThreatReference, and is used to select the next target.                                 *
+ * To manage a creature's threat list, ThreatManager maintains a flat list of threat reference const pointers.                                          *
+ * Modifying a ThreatReference only marks this list as unsorted; it is sorted lazily, once something actually needs the order.                          *
  *                                                                                                                                                      *
  * Selection uses the following properties on ThreatReference, in order:                                                                                *
  * - Online state (one of ONLINE, SUPPRESSED, OFFLINE):                                                                                                 *
@@ -65,7 +65,7 @@ class SpellInfo;
  * The current (= last selected) victim can be accessed using GetCurrentVictim.                                                                         *
  * Beyond that, ThreatManager has a variety of helpers and notifiers, which are documented inline below.                                                *
  *                                                                                                                                                      *
- * SPECIAL NOTE: Please be aware that any iterator may be invalidated if you modify a ThreatReference. The heap holds const pointers for a reason, but  *
+ * SPECIAL NOTE: Please be aware that any iterator may be invalidated if you modify a ThreatReference. The list holds const pointers for a reason, but  *
  *                 that doesn't mean you're scot free. A variety of actions (casting spells, teleporting units, and so forth) can cause changes to      *
  *                 the threat list. Use with care - or default to GetModifiableThreatList(), which inherently copies entries.                           *
 \********************************************************************************************************************************************************/
@@ -81,7 +81,6 @@ struct CompareThreatLessThan
 class TC_GAME_API ThreatManager
 {
     public:
-        class Heap;
         class ThreatListIterator;
         static const uint32 THREAT_UPDATE_INTERVAL = 1000u;
 
@@ -198,7 +197,11 @@ class TC_GAME_API ThreatManager
 
         bool _needClientUpdate;
         uint32 _updateTimer;
-        std::unique_ptr<Heap> _sortedThreatList;
+        // sorted highest threat first, but only while _sortedThreatListDirty is false - see SortThreatList
+        mutable std::vector<ThreatReference const*> _sortedThreatList;
+        mutable bool _sortedThreatListDirty;
+        void SortThreatList() const;
+        ThreatReference const* GetHighestThreatRef() const;
         std::unordered_map<ObjectGuid, ThreatReference*> _myThreatListEntries;
 
         // AI notifies are delayed to ensure we are in a consistent state before we call out to arbitrary logic
@@ -250,7 +253,6 @@ class TC_GAME_API ThreatManager
         };
 
     friend class ThreatReference;
-    friend class ThreatReferenceImpl;
     friend struct CompareThreatLessThan;
     friend class debug_commandscript;
 };
@@ -300,8 +302,7 @@ class TC_GAME_API ThreatReference
         void UpdateTauntState(TauntState state = TAUNT_STATE_NONE);
         Creature* const _owner;
         ThreatManager& _mgr;
-        void HeapNotifyIncreased();
-        void HeapNotifyDecreased();
+        void ListNotifyChanged() { _mgr._sortedThreatListDirty = true; }
         Unit* const _victim;
         OnlineState _online;
         float _baseAmount;
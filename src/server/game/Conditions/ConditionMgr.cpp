@@ -979,6 +979,44 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionContainer cons
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
 {
+    // compiled lists keep else groups contiguous, the first group with all of its conditions met decides the result
+    if (!conditions.empty() && conditions.back().EndsElseGroup)
+    {
+        bool groupMeets = true;
+        bool groupHasConditions = false;
+        for (Condition const& condition : conditions)
+        {
+            TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} val1: {}", condition.ToString(), condition.ConditionValue1);
+            if (groupMeets && condition.isLoaded())
+            {
+                groupHasConditions = true;
+                if (condition.ReferenceId)
+                {
+                    // resolved on every call, reference templates are replaced when conditions are reloaded
+                    auto ref = ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].find({ condition.ReferenceId, 0, 0 });
+                    if (ref != ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].end())
+                        groupMeets = IsObjectMeetToConditionList(sourceInfo, *ref->second);
+                    else
+                        TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
+                            condition.ToString(), condition.ReferenceId); // checked at loading, should never happen
+                }
+                else
+                    groupMeets = condition.Meets(sourceInfo);
+            }
+
+            if (condition.EndsElseGroup)
+            {
+                if (groupMeets && groupHasConditions)
+                    return true;
+
+                groupMeets = true;
+                groupHasConditions = false;
+            }
+        }
+
+        return false;
+    }
+
     //     groupId, groupCheckPassed
     std::map<uint32, bool> elseGroupStore;
     for (Condition const& condition : conditions)
@@ -1020,6 +1058,31 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
     return false;
 }
 
+void ConditionMgr::CompileConditionList(ConditionContainer& conditions) const
+{
+    if (conditions.empty())
+        return;
+
+    for (Condition& condition : conditions)
+        condition.EndsElseGroup = false;
+
+    // conditions are never reordered, the last failed condition is reported to the caster and condition scripts
+    // run in database order, only lists with contiguous else groups can be evaluated without tracking every group
+    std::unordered_set<uint32> finishedGroups;
+    for (std::size_t i = 1; i < conditions.size(); ++i)
+    {
+        if (conditions[i].ElseGroup == conditions[i - 1].ElseGroup)
+            continue;
+
+        finishedGroups.insert(conditions[i - 1].ElseGroup);
+        if (finishedGroups.contains(conditions[i].ElseGroup))
+            return;
+    }
+
+    for (std::size_t i = 0; i < conditions.size(); ++i)
+        conditions[i].EndsElseGroup = i + 1 == conditions.size() || conditions[i + 1].ElseGroup != conditions[i].ElseGroup;
+}
+
 bool ConditionMgr::IsObjectMeetToConditions(WorldObject const* object, ConditionContainer const& conditions) const
 {
     ConditionSourceInfo srcInfo = ConditionSourceInfo(object);
@@ -1208,6 +1271,24 @@ ConditionContainer const* ConditionMgr::GetConditionsForAreaTrigger(uint32 areaT
     return nullptr;
 }
 
+bool ConditionMgr::IsConditionListAffectedByQuest(ConditionContainer const& conditions, uint32 questId) const
+{
+    auto itr = QuestDependenciesByConditionList.find(&conditions);
+    if (itr == QuestDependenciesByConditionList.end())
+        return true; // not indexed, cannot tell
+
+    return itr->second.AnyQuest || std::binary_search(itr->second.QuestIds.begin(), itr->second.QuestIds.end(), questId);
+}
+
+bool ConditionMgr::IsTerrainSwapAffectedByQuest(uint32 terrainSwapId, uint32 questId) const
+{
+    auto itr = ConditionStore[CONDITION_SOURCE_TYPE_TERRAIN_SWAP].find({ 0, int32(terrainSwapId), 0 });
+    if (itr == ConditionStore[CONDITION_SOURCE_TYPE_TERRAIN_SWAP].end())
+        return false; // no conditions, always visible
+
+    return IsConditionListAffectedByQuest(*itr->second, questId);
+}
+
 bool ConditionMgr::IsObjectMeetingTrainerSpellConditions(uint32 trainerId, uint32 spellId, Player* player) const
 {
     auto itr = ConditionStore[CONDITION_SOURCE_TYPE_NPC_VENDOR].find({ trainerId, int32(spellId), 0 });
@@ -1367,6 +1448,11 @@ void ConditionMgr::LoadConditions(bool isReload)
     }
     while (result->NextRow());
 
+    // compile before handing out the lists, groupped types below keep pointers into them
+    for (ConditionsByEntryMap& conditionsByEntry : ConditionStore)
+        for (auto&& [id, conditions] : conditionsByEntry)
+            CompileConditionList(*conditions);
+
     for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_CREATURE_LOOT_TEMPLATE])
         addToLootTemplate(id, conditions, LootTemplates_Creature.GetLootForConditionFill(id.SourceGroup));
 
@@ -1422,6 +1508,9 @@ void ConditionMgr::LoadConditions(bool isReload)
     for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_PHASE])
         addToPhases(id, conditions);
 
+    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_TERRAIN_SWAP])
+        IndexQuestDependencies(*conditions);
+
     for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_GRAVEYARD])
         addToGraveyardData(id, conditions);
 
@@ -1581,13 +1670,14 @@ void ConditionMgr::addToSpellImplicitTargetConditions(Condition const& cond) con
                         break;
                 }
                 sharedList->push_back(cond);
+                CompileConditionList(*sharedList);
                 break;
             }
         }
     });
 }
 
-void ConditionMgr::addToPhases(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const
+void ConditionMgr::addToPhases(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions)
 {
     if (!id.SourceEntry)
     {
@@ -1603,6 +1693,8 @@ void ConditionMgr::addToPhases(ConditionId const& id, std::shared_ptr<std::vecto
                         if (phase.PhaseInfo->Id == id.SourceGroup)
                         {
                             phase.Conditions.insert(phase.Conditions.end(), conditions->begin(), conditions->end());
+                            CompileConditionList(phase.Conditions);
+                            IndexQuestDependencies(phase.Conditions);
                             found = true;
                         }
                     }
@@ -1620,6 +1712,8 @@ void ConditionMgr::addToPhases(ConditionId const& id, std::shared_ptr<std::vecto
             if (phase.PhaseInfo->Id == id.SourceGroup)
             {
                 phase.Conditions.insert(phase.Conditions.end(), conditions->begin(), conditions->end());
+                CompileConditionList(phase.Conditions);
+                IndexQuestDependencies(phase.Conditions);
                 return;
             }
         }
@@ -1629,6 +1723,48 @@ void ConditionMgr::addToPhases(ConditionId const& id, std::shared_ptr<std::vecto
         TC_LOG_ERROR("sql.sql", "{} Area {} does not have phase {}.", condition.ToString(), id.SourceEntry, id.SourceGroup);
 }
 
+void ConditionMgr::IndexQuestDependencies(ConditionContainer const& conditions)
+{
+    QuestDependencies& dependencies = QuestDependenciesByConditionList[&conditions];
+    dependencies.QuestIds.clear();
+    dependencies.AnyQuest = false;
+
+    for (Condition const& condition : conditions)
+    {
+        if (condition.ReferenceId || condition.ScriptId)
+        {
+            dependencies.AnyQuest = true;
+            continue;
+        }
+
+        switch (condition.ConditionType)
+        {
+            case CONDITION_QUESTREWARDED:
+            case CONDITION_QUESTTAKEN:
+            case CONDITION_QUEST_NONE:
+            case CONDITION_QUEST_COMPLETE:
+            case CONDITION_DAILY_QUEST_DONE:
+            case CONDITION_QUESTSTATE:
+                dependencies.QuestIds.push_back(condition.ConditionValue1);
+                break;
+            case CONDITION_QUEST_OBJECTIVE_PROGRESS:
+                if (QuestObjective const* questObjective = sObjectMgr->GetQuestObjective(condition.ConditionValue1))
+                    dependencies.QuestIds.push_back(questObjective->QuestID);
+                else
+                    dependencies.AnyQuest = true;
+                break;
+            case CONDITION_PLAYER_CONDITION:
+                dependencies.AnyQuest = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::sort(dependencies.QuestIds.begin(), dependencies.QuestIds.end());
+    dependencies.QuestIds.erase(std::unique(dependencies.QuestIds.begin(), dependencies.QuestIds.end()), dependencies.QuestIds.end());
+}
+
 void ConditionMgr::addToGraveyardData(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const
 {
     if (GraveyardData* graveyard = const_cast<GraveyardData*>(sObjectMgr->FindGraveyardData(id.SourceEntry, id.SourceGroup)))
@@ -2697,6 +2833,7 @@ void ConditionMgr::Clean()
         conditionsMap.clear();
 
     SpellsUsedInSpellClickConditions.clear();
+    QuestDependenciesByConditionList.clear();
 }
 
 inline bool PlayerConditionCompare(int32 comparisonType, int32 value1, int32 value2)
@@ -257,6 +257,9 @@ struct TC_GAME_API Condition
     uint8                   ConditionTarget;
     bool                    NegativeCondition;
 
+    // filled by ConditionMgr::CompileConditionList
+    bool                    EndsElseGroup;     // last condition of its ElseGroup, set only for compiled lists
+
     Condition()
     {
         SourceType         = CONDITION_SOURCE_TYPE_NONE;
@@ -274,6 +277,7 @@ struct TC_GAME_API Condition
         ErrorTextId        = 0;
         ScriptId           = 0;
         NegativeCondition  = false;
+        EndsElseGroup      = false;
     }
 
     bool Meets(ConditionSourceInfo& sourceInfo) const;
@@ -320,6 +324,8 @@ class TC_GAME_API ConditionMgr
         bool IsSpellUsedInSpellClickConditions(uint32 spellId) const;
 
         ConditionContainer const* GetConditionsForAreaTrigger(uint32 areaTriggerId, bool isServerSide) const;
+        bool IsConditionListAffectedByQuest(ConditionContainer const& conditions, uint32 questId) const;
+        bool IsTerrainSwapAffectedByQuest(uint32 terrainSwapId, uint32 questId) const;
         bool IsObjectMeetingTrainerSpellConditions(uint32 trainerId, uint32 spellId, Player* player) const;
         bool IsObjectMeetingVisibilityByObjectIdConditions(uint32 objectType, uint32 entry, WorldObject const* seer) const;
 
@@ -344,9 +350,11 @@ class TC_GAME_API ConditionMgr
         void addToGossipMenus(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
         void addToGossipMenuItems(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
         void addToSpellImplicitTargetConditions(Condition const& cond) const;
-        void addToPhases(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
+        void addToPhases(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions);
         void addToGraveyardData(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
         bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        void CompileConditionList(ConditionContainer& conditions) const;
+        void IndexQuestDependencies(ConditionContainer const& conditions);
 
         static void LogUselessConditionValue(Condition* cond, uint8 index, uint32 value);
 
@@ -355,6 +363,15 @@ class TC_GAME_API ConditionMgr
         ConditionEntriesByTypeArray     ConditionStore;
 
         std::unordered_set<uint32> SpellsUsedInSpellClickConditions;
+
+        struct QuestDependencies
+        {
+            std::vector<uint32> QuestIds;               // sorted
+            bool AnyQuest = false;                      // list checks quests indirectly (references, scripts, PlayerCondition)
+        };
+
+        // quests checked by phase area and terrain swap conditions, lets quest status changes skip unrelated phases
+        std::unordered_map<ConditionContainer const*, QuestDependencies> QuestDependenciesByConditionList;
 };
 
 #define sConditionMgr ConditionMgr::instance()
@@ -30,6 +30,7 @@
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "PhasingHandler.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -61,6 +62,18 @@ AreaTrigger::~AreaTrigger()
 {
 }
 
+static Trinity::ObjectPool<AreaTrigger> AreaTriggerPool("AreaTrigger");
+
+void* AreaTrigger::operator new(size_t size)
+{
+    return AreaTriggerPool.Allocate(size);
+}
+
+void AreaTrigger::operator delete(void* ptr, size_t size)
+{
+    AreaTriggerPool.Deallocate(ptr, size);
+}
+
 void AreaTrigger::AddToWorld()
 {
     ///- Register the AreaTrigger for guid lookup and for caster
@@ -40,6 +40,7 @@
 #include "MotionMaster.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "PhasingHandler.h"
 #include "Player.h"
 #include "PoolMgr.h"
@@ -294,7 +295,7 @@ bool ForcedDespawnDelayEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 
 Creature::Creature(bool isWorldObject): Unit(isWorldObject), MapObject(), m_PlayerDamageReq(0), _pickpocketLootRestore(0),
     m_corpseRemoveTime(0), m_respawnTime(0), m_respawnDelay(300), m_corpseDelay(60), m_ignoreCorpseDecayRatio(false), m_wanderDistance(0.0f), m_boundaryCheckTime(2500), m_combatPulseTime(0), m_combatPulseDelay(0), m_reactState(REACT_AGGRESSIVE),
-    m_defaultMovementType(IDLE_MOTION_TYPE), m_spawnId(UI64LIT(0)), m_equipmentId(0), m_originalEquipmentId(0), m_AlreadyCallAssistance(false), m_AlreadySearchedAssistance(false), m_cannotReachTarget(false), m_cannotReachTimer(0),
+    m_defaultMovementType(IDLE_MOTION_TYPE), m_spawnId(UI64LIT(0)), m_equipmentId(0), m_originalEquipmentId(0), m_AlreadyCallAssistance(false), m_AlreadySearchedAssistance(false), m_cannotReachTarget(false), m_cannotReachTimer(0), m_skippedUpdateDiff(0),
     m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_homePosition(), m_transportHomePosition(), m_creatureInfo(nullptr), m_creatureData(nullptr), m_creatureDifficulty(nullptr), _waypointPathId(0), _currentWaypointNodeInfo(0, 0),
     m_formation(nullptr), m_triggerJustAppeared(true), m_respawnCompatibilityMode(false), _lastDamagedTime(0),
     _regenerateHealth(true), _isMissingCanSwimFlagOutOfCombat(false), _creatureImmunitiesId(0), _gossipMenuId(0), _sparringHealthPct(0)
@@ -317,6 +318,18 @@ Creature::Creature(bool isWorldObject): Unit(isWorldObject), MapObject(), m_Play
 
 Creature::~Creature() = default;
 
+static Trinity::ObjectPool<Creature> CreaturePool("Creature");
+
+void* Creature::operator new(size_t size)
+{
+    return CreaturePool.Allocate(size);
+}
+
+void Creature::operator delete(void* ptr, size_t size)
+{
+    CreaturePool.Deallocate(ptr, size);
+}
+
 void Creature::AddToWorld()
 {
     ///- Register the creature for guid lookup
@@ -680,6 +693,26 @@ void Creature::ApplyAllStaticFlags(CreatureStaticFlagsHolder const& flags)
     SetTemplateRooted(flags.HasFlag(CREATURE_STATIC_FLAG_SESSILE));
 }
 
+bool Creature::CanUseReducedUpdateRate() const
+{
+    // the first update runs the JustAppeared hook and must not be delayed
+    if (m_triggerJustAppeared)
+        return false;
+
+    if (isActiveObject() || IsEngaged() || IsInEvadeMode() || HasUnitState(UNIT_STATE_CASTING))
+        return false;
+
+    // pets, guardians and charmed creatures follow their player
+    if (IsCharmedOwnedByPlayerOrPlayer())
+        return false;
+
+    // formation members move together with their leader
+    if (m_formation)
+        return false;
+
+    return true;
+}
+
 void Creature::Update(uint32 diff)
 {
     if (IsAIEnabled() && m_triggerJustAppeared && m_deathState != DEAD)
@@ -72,6 +72,9 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         explicit Creature(bool isWorldObject = false);
         ~Creature();
 
+        void* operator new(size_t size);
+        void operator delete(void* ptr, size_t size);
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
@@ -101,6 +104,11 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         ObjectGuid::LowType GetSpawnId() const { return m_spawnId; }
 
         void Update(uint32 time) override;                         // overwrited Unit::Update
+
+        // idle creatures far from players may be updated less often by their map, the skipped time is passed to the next update
+        bool CanUseReducedUpdateRate() const;
+        uint32 GetSkippedUpdateDiff() const { return m_skippedUpdateDiff; }
+        void SetSkippedUpdateDiff(uint32 diff) { m_skippedUpdateDiff = diff; }
         void GetRespawnPosition(float &x, float &y, float &z, float* ori = nullptr, float* dist = nullptr) const;
         bool IsSpawnedOnTransport() const { return m_creatureData && m_creatureData->mapId != GetMapId(); }
 
@@ -464,6 +472,7 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         bool m_AlreadySearchedAssistance;
         bool m_cannotReachTarget;
         uint32 m_cannotReachTimer;
+        uint32 m_skippedUpdateDiff;                         // (msecs) time accumulated while updates were skipped, see Map::UpdateActiveCells
 
         SpellSchoolMask m_meleeDamageSchoolMask;
         uint32 m_originalEntry;
@@ -27,6 +27,7 @@
 #include "Map.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Pet.h"
 #include "Player.h"
 #include "SmoothPhasing.h"
@@ -43,6 +44,18 @@ m_timer(0ms), m_lifetime(0ms), m_canFollowOwner(true)
     m_unitTypeMask |= UNIT_MASK_SUMMON;
 }
 
+static Trinity::ObjectPool<TempSummon> TempSummonPool("TempSummon");
+
+void* TempSummon::operator new(size_t size)
+{
+    return TempSummonPool.Allocate(size);
+}
+
+void TempSummon::operator delete(void* ptr, size_t size)
+{
+    TempSummonPool.Deallocate(ptr, size);
+}
+
 WorldObject* TempSummon::GetSummoner() const
 {
     return !m_summonerGUID.IsEmpty() ? ObjectAccessor::GetWorldObject(*this, m_summonerGUID) : nullptr;
@@ -46,6 +46,9 @@ class TC_GAME_API TempSummon : public Creature
     public:
         explicit TempSummon(SummonPropertiesEntry const* properties, WorldObject* owner, bool isWorldObject);
         virtual ~TempSummon() { }
+
+        void* operator new(size_t size);
+        void operator delete(void* ptr, size_t size);
         void Update(uint32 diff) override;
         virtual void InitStats(WorldObject* summoner, Milliseconds duration);
         virtual void InitSummon(WorldObject* summoner);
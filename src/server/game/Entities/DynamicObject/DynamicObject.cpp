@@ -21,6 +21,7 @@
 #include "Log.h"
 #include "Map.h"
 #include "ObjectAccessor.h"
+#include "ObjectPool.h"
 #include "PhasingHandler.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -52,6 +53,18 @@ DynamicObject::~DynamicObject()
     delete _removedAura;
 }
 
+static Trinity::ObjectPool<DynamicObject> DynamicObjectPool("DynamicObject");
+
+void* DynamicObject::operator new(size_t size)
+{
+    return DynamicObjectPool.Allocate(size);
+}
+
+void DynamicObject::operator delete(void* ptr, size_t size)
+{
+    DynamicObjectPool.Deallocate(ptr, size);
+}
+
 void DynamicObject::AddToWorld()
 {
     ///- Register the dynamicObject for guid lookup and for caster
@@ -42,6 +42,7 @@
 #include "MiscPackets.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "OutdoorPvPMgr.h"
 #include "PhasingHandler.h"
 #include "PoolMgr.h"
@@ -847,6 +848,18 @@ GameObject::~GameObject()
     delete m_model;
 }
 
+static Trinity::ObjectPool<GameObject> GameObjectPool("GameObject");
+
+void* GameObject::operator new(size_t size)
+{
+    return GameObjectPool.Allocate(size);
+}
+
+void GameObject::operator delete(void* ptr, size_t size)
+{
+    GameObjectPool.Deallocate(ptr, size);
+}
+
 void GameObject::AIM_Destroy()
 {
     delete m_AI;
@@ -3910,28 +3923,21 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
 
     bool forcedFlags = GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo()->chest.usegrouplootrules && HasLootRecipient();
 
-    std::size_t blockCount = UpdateMask::GetBlockCount(m_valuesCount);
-
-    uint32* flags = GameObjectUpdateFieldFlags;
     uint32 visibleFlag = UF_FLAG_PUBLIC;
     if (GetOwnerGUID() == target->GetGUID())
         visibleFlag |= UF_FLAG_OWNER;
 
-    *data << uint8(blockCount);
-    std::size_t maskPos = data->wpos();
-    data->resize(data->size() + blockCount * sizeof(UpdateMask::BlockType));
+    UpdateMask::ValuesMask mask;
+    std::size_t blockCount = BuildValuesUpdateMask(updateType, GameObjectUpdateFieldFlagMasks, visibleFlag, 0, m_valuesCount, mask);
+    if (forcedFlags)
+        UpdateMask::SetUpdateBit(mask.data(), GAMEOBJECT_FLAGS);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-    {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask[index] : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == GAMEOBJECT_FLAGS && forcedFlags))
-        {
-            UpdateMask::SetUpdateBit(data->contents() + maskPos, index);
+    AppendValuesUpdateMask(data, mask, blockCount);
 
-            *data << m_uint32Values[index];                // other cases
-        }
-    }
+    UpdateMask::ForEachUpdateBit(mask.data(), blockCount, [&](std::size_t index)
+    {
+        *data << m_uint32Values[index];
+    });
 }
 
 void GameObject::GetRespawnPosition(float &x, float &y, float &z, float* ori /* = nullptr*/) const
@@ -1574,15 +1574,16 @@ void Item::BuildDynamicValuesUpdate(uint8 updateType, ByteBuffer* data, Player*
 
     for (uint16 index = 0; index < _dynamicValuesCount; ++index)
     {
-        std::vector<uint32> const& values = _dynamicValues[index];
+        std::vector<uint32> const& values = GetDynamicValues(index);
+        UpdateMask::DynamicFieldChangeType changeType = GetDynamicChangeType(index);
         if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _dynamicChangesMask[index] != UpdateMask::UNCHANGED : !values.empty()) && (flags[index] & visibleFlag)))
+            ((updateType == UPDATETYPE_VALUES ? changeType != UpdateMask::UNCHANGED : !values.empty()) && (flags[index] & visibleFlag)))
         {
             UpdateMask::SetUpdateBit(data->contents() + maskPos, index);
 
             std::size_t arrayBlockCount = UpdateMask::GetBlockCount(values.size());
-            *data << DynamicFieldChangeTypeUT(UpdateMask::EncodeDynamicFieldChangeType(arrayBlockCount, _dynamicChangesMask[index], updateType));
-            if (updateType == UPDATETYPE_VALUES && _dynamicChangesMask[index] == UpdateMask::VALUE_AND_SIZE_CHANGED)
+            *data << DynamicFieldChangeTypeUT(UpdateMask::EncodeDynamicFieldChangeType(arrayBlockCount, changeType, updateType));
+            if (updateType == UPDATETYPE_VALUES && changeType == UpdateMask::VALUE_AND_SIZE_CHANGED)
                 *data << uint32(values.size());
 
             std::size_t arrayMaskPos = data->wpos();
@@ -1603,7 +1604,7 @@ void Item::BuildDynamicValuesUpdate(uint8 updateType, ByteBuffer* data, Player*
                 uint32 m = 0;
 
                 // work around stupid item modifier field requirements - push back values mask by sizeof(m) bytes if size was not appended yet
-                if (updateType == UPDATETYPE_VALUES && _dynamicChangesMask[index] != UpdateMask::VALUE_AND_SIZE_CHANGED && _changesMask[ITEM_FIELD_MODIFIERS_MASK])
+                if (updateType == UPDATETYPE_VALUES && changeType != UpdateMask::VALUE_AND_SIZE_CHANGED && _changesMask[ITEM_FIELD_MODIFIERS_MASK])
                 {
                     data->put(arrayMaskPos - sizeof(DynamicFieldChangeTypeUT), data->read<uint16>(arrayMaskPos - sizeof(DynamicFieldChangeTypeUT)) | UpdateMask::VALUE_AND_SIZE_CHANGED);
                     *data << m;
@@ -118,15 +118,36 @@ void Object::_InitValues()
     m_uint32Values = new uint32[m_valuesCount];
     memset(m_uint32Values, 0, m_valuesCount * sizeof(uint32));
 
-    _changesMask.resize(m_valuesCount);
+    _changesMask.Resize(m_valuesCount);
+
+    m_objectUpdated = false;
+}
+
+void Object::AllocateDynamicValues()
+{
+    if (_dynamicValues)
+        return;
+
+    _dynamicValues = new std::vector<uint32>[_dynamicValuesCount];
+    _dynamicChangesArrayMask = new std::vector<uint8>[_dynamicValuesCount];
     _dynamicChangesMask.resize(_dynamicValuesCount);
-    if (_dynamicValuesCount)
+}
+
+UpdateFieldMemoryUsage Object::GetUpdateFieldMemoryUsage() const
+{
+    UpdateFieldMemoryUsage usage;
+    if (m_uint32Values)
+        usage.Values = m_valuesCount * sizeof(uint32);
+
+    usage.ChangesMask = _changesMask.GetAllocatedSize();
+    if (_dynamicValues)
     {
-        _dynamicValues = new std::vector<uint32>[_dynamicValuesCount];
-        _dynamicChangesArrayMask = new std::vector<uint8>[_dynamicValuesCount];
+        usage.DynamicValues = _dynamicValuesCount * (sizeof(std::vector<uint32>) + sizeof(std::vector<uint8>) + sizeof(UpdateMask::DynamicFieldChangeType));
+        for (uint16 i = 0; i < _dynamicValuesCount; ++i)
+            usage.DynamicValues += _dynamicValues[i].capacity() * sizeof(uint32) + _dynamicChangesArrayMask[i].capacity();
     }
 
-    m_objectUpdated = false;
+    return usage;
 }
 
 void Object::_Create(ObjectGuid const& guid)
@@ -245,7 +266,7 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
         if (unit->GetVictim())
             flags |= UPDATEFLAG_HAS_TARGET;
 
-    ByteBuffer buf(0x400, ByteBuffer::Reserve{});
+    ByteBuffer& buf = data->AddUpdateBlock();
     buf << uint8(updateType);
     buf << GetGUID();
     buf << uint8(m_objectTypeId);
@@ -253,7 +274,6 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
     BuildMovementUpdate(&buf, flags);
     BuildValuesUpdate(updateType, &buf, target);
     BuildDynamicValuesUpdate(updateType, &buf, target);
-    data->AddUpdateBlock(buf);
 }
 
 void Object::SendUpdateToPlayer(Player* player)
@@ -272,15 +292,13 @@ void Object::SendUpdateToPlayer(Player* player)
 
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target) const
 {
-    ByteBuffer buf(500, ByteBuffer::Reserve{});
+    ByteBuffer& buf = data->AddUpdateBlock();
 
     buf << uint8(UPDATETYPE_VALUES);
     buf << GetGUID();
 
     BuildValuesUpdate(UPDATETYPE_VALUES, &buf, target);
     BuildDynamicValuesUpdate(UPDATETYPE_VALUES, &buf, target);
-
-    data->AddUpdateBlock(buf);
 }
 
 void Object::BuildDestroyUpdateBlock(UpdateData* data) const
@@ -804,25 +822,61 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     if (!target)
         return;
 
-    std::size_t blockCount = UpdateMask::GetBlockCount(m_valuesCount);
+    UpdateFieldFlagMasks const* flagMasks = nullptr;
+    uint32 visibleFlag = GetUpdateFieldData(target, flagMasks);
+    ASSERT(flagMasks);
 
-    uint32* flags = NULL;
-    uint32 visibleFlag = GetUpdateFieldData(target, flags);
-    ASSERT(flags);
+    UpdateMask::ValuesMask mask;
+    std::size_t blockCount = BuildValuesUpdateMask(updateType, *flagMasks, visibleFlag, 0, m_valuesCount, mask);
+    AppendValuesUpdateMask(data, mask, blockCount);
 
-    *data << uint8(blockCount);
-    std::size_t maskPos = data->wpos();
-    data->resize(data->size() + blockCount * sizeof(UpdateMask::BlockType));
+    UpdateMask::ForEachUpdateBit(mask.data(), blockCount, [&](std::size_t index)
+    {
+        *data << m_uint32Values[index];
+    });
+}
+
+std::size_t Object::BuildValuesUpdateMask(uint8 updateType, UpdateFieldFlagMasks const& flagMasks, uint32 visibleFlag, uint32 alwaysVisibleFlag,
+    uint32 valuesCount, UpdateMask::ValuesMask& mask) const
+{
+    using BitsPerBlock = std::integral_constant<std::size_t, sizeof(UpdateMask::BlockType) * 8>;
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    std::size_t blockCount = UpdateMask::GetBlockCount(valuesCount);
+    ASSERT(blockCount <= mask.size() && blockCount <= flagMasks.GetBlockCount());
+
+    for (std::size_t block = 0; block < blockCount; ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask[index] : m_uint32Values[index]) && (flags[index] & visibleFlag)))
+        UpdateMask::BlockType fields = flagMasks.GetBlock(_fieldNotifyFlags | alwaysVisibleFlag, block);
+        UpdateMask::BlockType visibleFields = flagMasks.GetBlock(visibleFlag, block);
+        if (updateType == UPDATETYPE_VALUES)
+            fields |= _changesMask.GetBlock(block) & visibleFields;
+        else
         {
-            UpdateMask::SetUpdateBit(data->contents() + maskPos, index);
-            *data << m_uint32Values[index];
+            // only look at values of visible fields that are not already selected
+            uint32 const* values = &m_uint32Values[block * BitsPerBlock::value];
+            for (UpdateMask::BlockType bits = visibleFields & ~fields; bits; bits &= bits - 1)
+            {
+                std::size_t bit = std::countr_zero(bits);
+                if (block * BitsPerBlock::value + bit < valuesCount && values[bit])
+                    fields |= UpdateMask::BlockType(1) << bit;
+            }
         }
+
+        mask[block] = fields;
     }
+
+    // drop fields past valuesCount in last block (flag tables can be longer than object values, ex. units and players share one)
+    if (std::size_t usedBits = valuesCount % BitsPerBlock::value)
+        mask[blockCount - 1] &= (UpdateMask::BlockType(1) << usedBits) - 1;
+
+    return blockCount;
+}
+
+void Object::AppendValuesUpdateMask(ByteBuffer* data, UpdateMask::ValuesMask const& mask, std::size_t blockCount)
+{
+    *data << uint8(blockCount);
+    for (std::size_t block = 0; block < blockCount; ++block)
+        *data << uint32(mask[block]);
 }
 
 void Object::BuildDynamicValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) const
@@ -841,15 +895,16 @@ void Object::BuildDynamicValuesUpdate(uint8 updateType, ByteBuffer* data, Player
 
     for (uint16 index = 0; index < _dynamicValuesCount; ++index)
     {
-        std::vector<uint32> const& values = _dynamicValues[index];
+        std::vector<uint32> const& values = GetDynamicValues(index);
+        UpdateMask::DynamicFieldChangeType changeType = GetDynamicChangeType(index);
         if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _dynamicChangesMask[index] != UpdateMask::UNCHANGED : !values.empty()) && (flags[index] & visibleFlag)))
+            ((updateType == UPDATETYPE_VALUES ? changeType != UpdateMask::UNCHANGED : !values.empty()) && (flags[index] & visibleFlag)))
         {
             UpdateMask::SetUpdateBit(data->contents() + maskPos, index);
 
             std::size_t arrayBlockCount = UpdateMask::GetBlockCount(values.size());
-            *data << uint16(UpdateMask::EncodeDynamicFieldChangeType(arrayBlockCount, _dynamicChangesMask[index], updateType));
-            if (_dynamicChangesMask[index] == UpdateMask::VALUE_AND_SIZE_CHANGED && updateType == UPDATETYPE_VALUES)
+            *data << uint16(UpdateMask::EncodeDynamicFieldChangeType(arrayBlockCount, changeType, updateType));
+            if (changeType == UpdateMask::VALUE_AND_SIZE_CHANGED && updateType == UPDATETYPE_VALUES)
                 *data << uint32(values.size());
 
             std::size_t arrayMaskPos = data->wpos();
@@ -877,10 +932,13 @@ void Object::AddToObjectUpdateIfNeeded()
 
 void Object::ClearUpdateMask(bool remove)
 {
-    memset(_changesMask.data(), 0, _changesMask.size());
-    _dynamicChangesMask.assign(_dynamicChangesMask.size(), UpdateMask::UNCHANGED);
-    for (uint32 i = 0; i < _dynamicValuesCount; ++i)
-        memset(_dynamicChangesArrayMask[i].data(), 0, _dynamicChangesArrayMask[i].size());
+    _changesMask.Reset();
+    if (_dynamicValues)
+    {
+        _dynamicChangesMask.assign(_dynamicChangesMask.size(), UpdateMask::UNCHANGED);
+        for (uint32 i = 0; i < _dynamicValuesCount; ++i)
+            memset(_dynamicChangesArrayMask[i].data(), 0, _dynamicChangesArrayMask[i].size());
+    }
 
     if (m_objectUpdated)
     {
@@ -904,7 +962,7 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) cons
     BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
 }
 
-uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
+uint32 Object::GetUpdateFieldData(Player const* target, UpdateFieldFlagMasks const*& flagMasks) const
 {
     uint32 visibleFlag = UF_FLAG_PUBLIC;
 
@@ -915,7 +973,7 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
     {
         case TYPEID_ITEM:
         case TYPEID_CONTAINER:
-            flags = ItemUpdateFieldFlags;
+            flagMasks = &ItemUpdateFieldFlagMasks;
             if (((Item const*)this)->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER | UF_FLAG_ITEM_OWNER;
             break;
@@ -923,7 +981,7 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
         case TYPEID_PLAYER:
         {
             Player* plr = ToUnit()->GetCharmerOrOwnerPlayerOrPlayerItself();
-            flags = UnitUpdateFieldFlags;
+            flagMasks = &UnitUpdateFieldFlagMasks;
             if (ToUnit()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
 
@@ -936,28 +994,28 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
             break;
         }
         case TYPEID_GAMEOBJECT:
-            flags = GameObjectUpdateFieldFlags;
+            flagMasks = &GameObjectUpdateFieldFlagMasks;
             if (ToGameObject()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
         case TYPEID_DYNAMICOBJECT:
-            flags = DynamicObjectUpdateFieldFlags;
+            flagMasks = &DynamicObjectUpdateFieldFlagMasks;
             if (ToDynObject()->GetCasterGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
         case TYPEID_CORPSE:
-            flags = CorpseUpdateFieldFlags;
+            flagMasks = &CorpseUpdateFieldFlagMasks;
             if (ToCorpse()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
         case TYPEID_AREATRIGGER:
-            flags = AreaTriggerUpdateFieldFlags;
+            flagMasks = &AreaTriggerUpdateFieldFlagMasks;
             break;
         case TYPEID_SCENEOBJECT:
-            flags = SceneObjectUpdateFieldFlags;
+            flagMasks = &SceneObjectUpdateFieldFlagMasks;
             break;
         case TYPEID_CONVERSATION:
-            flags = ConversationUpdateFieldFlags;
+            flagMasks = &ConversationUpdateFieldFlagMasks;
             break;
         case TYPEID_OBJECT:
             ABORT();
@@ -1027,7 +1085,7 @@ void Object::_LoadIntoDataField(std::string const& data, uint32 startOffset, uin
     for (uint32 index = 0; index < count; ++index)
     {
         m_uint32Values[startOffset + index] = Trinity::StringTo<int32>(tokens[index]).value_or(0);
-        _changesMask[startOffset + index] = 1;
+        MarkFieldChanged(startOffset + index);
     }
 }
 
@@ -1038,7 +1096,7 @@ void Object::SetInt32Value(uint16 index, int32 value)
     if (m_int32Values[index] != value)
     {
         m_int32Values[index] = value;
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1051,7 +1109,7 @@ void Object::SetUInt32Value(uint16 index, uint32 value)
     if (m_uint32Values[index] != value)
     {
         m_uint32Values[index] = value;
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1062,7 +1120,7 @@ void Object::UpdateUInt32Value(uint16 index, uint32 value)
     ASSERT(index < m_valuesCount || PrintIndexError(index, true));
 
     m_uint32Values[index] = value;
-    _changesMask[index] = 1;
+    MarkFieldChanged(index);
 }
 
 void Object::SetUInt64Value(uint16 index, uint64 value)
@@ -1072,8 +1130,8 @@ void Object::SetUInt64Value(uint16 index, uint64 value)
     {
         m_uint32Values[index] = PAIR64_LOPART(value);
         m_uint32Values[index + 1] = PAIR64_HIPART(value);
-        _changesMask[index] = 1;
-        _changesMask[index + 1] = 1;
+        MarkFieldChanged(index);
+        MarkFieldChanged(index + 1);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1085,10 +1143,10 @@ bool Object::AddGuidValue(uint16 index, ObjectGuid const& value)
     if (!value.IsEmpty() && ((ObjectGuid*)&(m_uint32Values[index]))->IsEmpty())
     {
         *((ObjectGuid*)&(m_uint32Values[index])) = value;
-        _changesMask[index] = 1;
-        _changesMask[index + 1] = 1;
-        _changesMask[index + 2] = 1;
-        _changesMask[index + 3] = 1;
+        MarkFieldChanged(index);
+        MarkFieldChanged(index + 1);
+        MarkFieldChanged(index + 2);
+        MarkFieldChanged(index + 3);
 
         AddToObjectUpdateIfNeeded();
         return true;
@@ -1103,10 +1161,10 @@ bool Object::RemoveGuidValue(uint16 index, ObjectGuid const& value)
     if (!value.IsEmpty() && *((ObjectGuid*)&(m_uint32Values[index])) == value)
     {
         ((ObjectGuid*)&(m_uint32Values[index]))->Clear();
-        _changesMask[index] = 1;
-        _changesMask[index + 1] = 1;
-        _changesMask[index + 2] = 1;
-        _changesMask[index + 3] = 1;
+        MarkFieldChanged(index);
+        MarkFieldChanged(index + 1);
+        MarkFieldChanged(index + 2);
+        MarkFieldChanged(index + 3);
 
         AddToObjectUpdateIfNeeded();
         return true;
@@ -1122,7 +1180,7 @@ void Object::SetFloatValue(uint16 index, float value)
     if (m_floatValues[index] != value)
     {
         m_floatValues[index] = value;
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1142,7 +1200,7 @@ void Object::SetByteValue(uint16 index, uint8 offset, uint8 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFF) << (offset * 8));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 8));
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1162,7 +1220,7 @@ void Object::SetUInt16Value(uint16 index, uint8 offset, uint16 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFFFF) << (offset * 16));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 16));
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1174,10 +1232,10 @@ void Object::SetGuidValue(uint16 index, ObjectGuid const& value)
     if (*((ObjectGuid*)&(m_uint32Values[index])) != value)
     {
         *((ObjectGuid*)&(m_uint32Values[index])) = value;
-        _changesMask[index] = 1;
-        _changesMask[index + 1] = 1;
-        _changesMask[index + 2] = 1;
-        _changesMask[index + 3] = 1;
+        MarkFieldChanged(index);
+        MarkFieldChanged(index + 1);
+        MarkFieldChanged(index + 2);
+        MarkFieldChanged(index + 3);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1256,7 +1314,7 @@ void Object::SetFlag(uint16 index, uint32 newFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1273,7 +1331,7 @@ void Object::RemoveFlag(uint16 index, uint32 oldFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1313,7 +1371,7 @@ void Object::SetByteFlag(uint16 index, uint8 offset, uint8 newFlag)
     if (!(uint8(m_uint32Values[index] >> (offset * 8)) & newFlag))
     {
         m_uint32Values[index] |= uint32(uint32(newFlag) << (offset * 8));
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1332,7 +1390,7 @@ void Object::RemoveByteFlag(uint16 index, uint8 offset, uint8 oldFlag)
     if (uint8(m_uint32Values[index] >> (offset * 8)) & oldFlag)
     {
         m_uint32Values[index] &= ~uint32(uint32(oldFlag) << (offset * 8));
-        _changesMask[index] = 1;
+        MarkFieldChanged(index);
 
         AddToObjectUpdateIfNeeded();
     }
@@ -1388,22 +1446,23 @@ void Object::ApplyModFlag64(uint16 index, uint64 flag, bool apply)
 
 std::vector<uint32> const& Object::GetDynamicValues(uint16 index) const
 {
+    static std::vector<uint32> const EmptyDynamicValues;
+
     ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
-    return _dynamicValues[index];
+    return _dynamicValues ? _dynamicValues[index] : EmptyDynamicValues;
 }
 
 uint32 Object::GetDynamicValue(uint16 index, uint16 offset) const
 {
-    ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
-    if (offset >= _dynamicValues[index].size())
+    std::vector<uint32> const& values = GetDynamicValues(index);
+    if (offset >= values.size())
         return 0;
-    return _dynamicValues[index][offset];
+    return values[offset];
 }
 
 bool Object::HasDynamicValue(uint16 index, uint32 value)
 {
-    ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
-    std::vector<uint32>& values = _dynamicValues[index];
+    std::vector<uint32> const& values = GetDynamicValues(index);
     for (std::size_t i = 0; i < values.size(); ++i)
         if (values[i] == value)
             return true;
@@ -1413,13 +1472,14 @@ bool Object::HasDynamicValue(uint16 index, uint32 value)
 
 void Object::AddDynamicValue(uint16 index, uint32 value)
 {
-    ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
-    SetDynamicValue(index, _dynamicValues[index].size(), value);
+    SetDynamicValue(index, GetDynamicValues(index).size(), value);
 }
 
 void Object::RemoveDynamicValue(uint16 index, uint32 value)
 {
     ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
+    if (!_dynamicValues)
+        return;
 
     // TODO: Research if this is blizzlike to just set value to 0
     std::vector<uint32>& values = _dynamicValues[index];
@@ -1440,7 +1500,7 @@ void Object::ClearDynamicValue(uint16 index)
 {
     ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
 
-    if (!_dynamicValues[index].empty())
+    if (_dynamicValues && !_dynamicValues[index].empty())
     {
         _dynamicValues[index].clear();
         _dynamicChangesMask[index] = UpdateMask::VALUE_AND_SIZE_CHANGED;
@@ -1453,6 +1513,7 @@ void Object::ClearDynamicValue(uint16 index)
 void Object::SetDynamicValue(uint16 index, uint16 offset, uint32 value)
 {
     ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
+    AllocateDynamicValues();
 
     UpdateMask::DynamicFieldChangeType changeType = UpdateMask::VALUE_CHANGED;
     std::vector<uint32>& values = _dynamicValues[index];
@@ -2392,7 +2453,7 @@ bool WorldObject::CanDetectStealthOf(WorldObject const* obj, bool checkAlert) co
 
 void Object::ForceValuesUpdateAtIndex(uint32 i)
 {
-    _changesMask[i] = 1;
+    MarkFieldChanged(i);
     AddToObjectUpdateIfNeeded();
 }
 
@@ -2420,6 +2481,10 @@ struct CombatLogSender
 {
     WorldPackets::CombatLog::CombatLogServerPacket const* i_message;
 
+    // copies shared by every observer, created on first use
+    mutable std::shared_ptr<WorldPacket const> i_fullLog;
+    mutable std::shared_ptr<WorldPacket const> i_basicLog;
+
     explicit CombatLogSender(WorldPackets::CombatLog::CombatLogServerPacket* msg)
         : i_message(msg)
     {
@@ -2428,10 +2493,12 @@ struct CombatLogSender
 
     void operator()(Player const* player) const
     {
-        if (player->IsAdvancedCombatLoggingEnabled())
-            player->SendDirectMessage(i_message->GetFullLogPacket());
-        else
-            player->SendDirectMessage(i_message->GetBasicLogPacket());
+        bool advanced = player->IsAdvancedCombatLoggingEnabled();
+        std::shared_ptr<WorldPacket const>& shared = advanced ? i_fullLog : i_basicLog;
+        if (!shared)
+            shared = std::make_shared<WorldPacket const>(*(advanced ? i_message->GetFullLogPacket() : i_message->GetBasicLogPacket()));
+
+        player->SendDirectMessage(shared);
     }
 };
 
@@ -32,6 +32,8 @@
 #include "SharedDefines.h"
 #include "SpellDefines.h"
 #include "UpdateFields.h"
+#include <array>
+#include <bit>
 #include <list>
 #include <unordered_map>
 #include <memory>
@@ -58,6 +60,7 @@ class TempSummon;
 class TransportBase;
 class Unit;
 class UpdateData;
+class UpdateFieldFlagMasks;
 class WorldObject;
 class WorldPacket;
 class ZoneScript;
@@ -89,7 +92,7 @@ namespace UpdateMask
         VALUE_AND_SIZE_CHANGED  = 0x8000
     };
 
-    inline std::size_t GetBlockCount(std::size_t bitCount)
+    constexpr std::size_t GetBlockCount(std::size_t bitCount)
     {
         using BitsPerBlock = std::integral_constant<std::size_t, sizeof(BlockType) * 8>;
         return (bitCount + BitsPerBlock::value - 1) / BitsPerBlock::value;
@@ -107,6 +110,46 @@ namespace UpdateMask
         using BitsPerBlock = std::integral_constant<std::size_t, sizeof(T) * 8>;
         data[bitIndex / BitsPerBlock::value] |= T(1) << (bitIndex % BitsPerBlock::value);
     }
+
+    // Calls callback with index of every set bit, in ascending order
+    template<typename Callback>
+    inline void ForEachUpdateBit(BlockType const* data, std::size_t blockCount, Callback&& callback)
+    {
+        using BitsPerBlock = std::integral_constant<std::size_t, sizeof(BlockType) * 8>;
+        for (std::size_t block = 0; block < blockCount; ++block)
+            for (BlockType bits = data[block]; bits; bits &= bits - 1)
+                callback(block * BitsPerBlock::value + std::countr_zero(bits));
+    }
+
+    // Changed fields of an object, packed one bit per field in the same layout as update masks sent to client
+    // Storage is allocated on first change after the object was added to world
+    class ChangesMask
+    {
+    public:
+        void Resize(std::size_t bitCount) { _blockCount = uint32(GetBlockCount(bitCount)); _blocks.reset(); }
+        void Reset() { if (_blocks) std::fill_n(_blocks.get(), _blockCount, BlockType(0)); }
+
+        void Set(std::size_t bitIndex)
+        {
+            if (!_blocks)
+                _blocks = std::make_unique<BlockType[]>(_blockCount);
+
+            SetUpdateBit(_blocks.get(), bitIndex);
+        }
+
+        bool operator[](std::size_t bitIndex) const { return _blocks && ((_blocks[bitIndex / (sizeof(BlockType) * 8)] >> (bitIndex % (sizeof(BlockType) * 8))) & 1); }
+
+        BlockType GetBlock(std::size_t block) const { return _blocks ? _blocks[block] : BlockType(0); }
+
+        std::size_t GetAllocatedSize() const { return _blocks ? _blockCount * sizeof(BlockType) : 0; }
+
+    private:
+        std::unique_ptr<BlockType[]> _blocks;
+        uint32 _blockCount = 0;
+    };
+
+    // Large enough to hold update mask of any object type
+    using ValuesMask = std::array<BlockType, GetBlockCount(PLAYER_END)>;
 }
 
 // Helper class used to iterate object dynamic fields while interpreting them as a structure instead of raw int array
@@ -136,6 +179,14 @@ private:
     std::vector<uint32> const& _data;
 };
 
+// Heap memory used by update field storage of an object
+struct UpdateFieldMemoryUsage
+{
+    std::size_t Values = 0;
+    std::size_t ChangesMask = 0;
+    std::size_t DynamicValues = 0;
+};
+
 float const DEFAULT_COLLISION_HEIGHT = 2.03128f; // Most common value in dbc
 
 class TC_GAME_API Object
@@ -233,8 +284,7 @@ class TC_GAME_API Object
         {
             static_assert(std::is_standard_layout<T>::value && std::is_trivially_destructible<T>::value, "T used for Object::SetDynamicStructuredValue<T> is not a trivially destructible standard layout type");
             using BlockCount = std::integral_constant<uint16, sizeof(T) / sizeof(uint32)>;
-            ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
-            std::vector<uint32> const& values = _dynamicValues[index];
+            std::vector<uint32> const& values = GetDynamicValues(index);
             ASSERT((values.size() % BlockCount::value) == 0, "Dynamic field value count must exactly fit into structure");
             return DynamicFieldStructuredView<T>(values);
         }
@@ -244,8 +294,7 @@ class TC_GAME_API Object
         {
             static_assert(std::is_standard_layout<T>::value && std::is_trivially_destructible<T>::value, "T used for Object::SetDynamicStructuredValue<T> is not a trivially destructible standard layout type");
             using BlockCount = std::integral_constant<uint16, sizeof(T) / sizeof(uint32)>;
-            ASSERT(index < _dynamicValuesCount || PrintIndexError(index, false));
-            std::vector<uint32> const& values = _dynamicValues[index];
+            std::vector<uint32> const& values = GetDynamicValues(index);
             ASSERT((values.size() % BlockCount::value) == 0, "Dynamic field value count must exactly fit into structure");
             if (offset * BlockCount::value >= values.size())
                 return nullptr;
@@ -267,7 +316,7 @@ class TC_GAME_API Object
         {
             static_assert(std::is_standard_layout<T>::value && std::is_trivially_destructible<T>::value, "T used for Object::SetDynamicStructuredValue<T> is not a trivially destructible standard layout type");
             using BlockCount = std::integral_constant<uint16, sizeof(T) / sizeof(uint32)>;
-            std::vector<uint32> const& values = _dynamicValues[index];
+            std::vector<uint32> const& values = GetDynamicValues(index);
             uint16 offset = uint16(values.size() / BlockCount::value);
             SetDynamicValue(index, (offset + 1) * BlockCount::value - 1, 0); // reserve space
             for (uint16 i = 0; i < BlockCount::value; ++i)
@@ -277,6 +326,7 @@ class TC_GAME_API Object
         void ClearUpdateMask(bool remove);
 
         uint16 GetValuesCount() const { return m_valuesCount; }
+        UpdateFieldMemoryUsage GetUpdateFieldMemoryUsage() const;
 
         virtual std::string GetNameForLocaleIdx(LocaleConstant locale) const = 0;
 
@@ -358,13 +408,18 @@ class TC_GAME_API Object
         std::string _ConcatFields(uint16 startIndex, uint16 size) const;
         void _LoadIntoDataField(std::string const& data, uint32 startOffset, uint32 count);
 
-        uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
+        uint32 GetUpdateFieldData(Player const* target, UpdateFieldFlagMasks const*& flagMasks) const;
         uint32 GetDynamicUpdateFieldData(Player const* target, uint32*& flags) const;
 
         void BuildMovementUpdate(ByteBuffer* data, uint32 flags) const;
         virtual void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
         virtual void BuildDynamicValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
 
+        // Selects fields to send to a target a whole mask block at a time, returns number of blocks used
+        std::size_t BuildValuesUpdateMask(uint8 updateType, UpdateFieldFlagMasks const& flagMasks, uint32 visibleFlag, uint32 alwaysVisibleFlag,
+            uint32 valuesCount, UpdateMask::ValuesMask& mask) const;
+        static void AppendValuesUpdateMask(ByteBuffer* data, UpdateMask::ValuesMask const& mask, std::size_t blockCount);
+
         uint16 m_objectType;
 
         TypeID m_objectTypeId;
@@ -377,9 +432,9 @@ class TC_GAME_API Object
             float  *m_floatValues;
         };
 
-        std::vector<uint32>* _dynamicValues;
+        std::vector<uint32>* _dynamicValues;                // allocated on first write together with dynamic change masks
 
-        std::vector<uint8> _changesMask;
+        UpdateMask::ChangesMask _changesMask;
         std::vector<UpdateMask::DynamicFieldChangeType> _dynamicChangesMask;
         std::vector<uint8>* _dynamicChangesArrayMask;
 
@@ -388,6 +443,11 @@ class TC_GAME_API Object
 
         uint16 _fieldNotifyFlags;
 
+        UpdateMask::DynamicFieldChangeType GetDynamicChangeType(uint16 index) const { return _dynamicValues ? _dynamicChangesMask[index] : UpdateMask::UNCHANGED; }
+
+        // values set before the object is added to world are sent by its create block, their changes don't need tracking
+        void MarkFieldChanged(std::size_t index) { if (m_inWorld) _changesMask.Set(index); }
+
         virtual bool AddToObjectUpdate() = 0;
         virtual void RemoveFromObjectUpdate() = 0;
         void AddToObjectUpdateIfNeeded();
@@ -404,6 +464,8 @@ class TC_GAME_API Object
         Object& operator=(Object const& right) = delete;
         Object& operator=(Object&& right) = delete;
 
+        void AllocateDynamicValues();
+
         // for output helpfull error messages from asserts
         bool PrintIndexError(uint32 index, bool set) const;
 };
@@ -20,8 +20,56 @@
 #include "Errors.h"
 #include "WorldPacket.h"
 #include "Opcodes.h"
+#include <atomic>
 
-UpdateData::UpdateData(uint32 map) : m_map(map), m_blockCount(0) { }
+namespace
+{
+    // SMSG_UPDATE_OBJECT header without out of range objects: block count, map, has out of range bit and data size
+    constexpr std::size_t PacketHeaderSize = 4 + 2 + 1 + 4;
+    constexpr std::size_t InitialBufferSize = 0x1000;
+
+    // do not hoard memory after large bursts like login or teleport
+    constexpr std::size_t MaxCachedBytes = 4 * 1024 * 1024;
+    constexpr std::size_t MaxCachedBufferCapacity = 0x10000;
+
+    // each map update thread reuses its own buffers, no locking needed
+    thread_local std::vector<std::vector<uint8>> BufferCache;
+    thread_local std::size_t CachedBytes = 0;
+
+    std::atomic<uint64> AllocatedBuffers;
+    std::atomic<uint64> ReusedBuffers;
+    std::atomic<uint64> GrownBuffers;
+
+    std::vector<uint8> AcquireBuffer()
+    {
+        std::vector<uint8> buffer;
+        if (!BufferCache.empty())
+        {
+            buffer = std::move(BufferCache.back());
+            BufferCache.pop_back();
+            CachedBytes -= buffer.capacity();
+            ReusedBuffers.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            buffer.reserve(InitialBufferSize);
+            AllocatedBuffers.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return buffer;
+    }
+}
+
+UpdateData::UpdateData(uint32 map) : m_map(map), m_blockCount(0), m_data(AcquireBuffer())
+{
+    m_initialCapacity = m_data.capacity();
+    m_data.resize(PacketHeaderSize);
+}
+
+UpdateData::~UpdateData()
+{
+    ReleaseBuffer(m_data.Move());
+}
 
 void UpdateData::AddOutOfRangeGUID(GuidSet& guids)
 {
@@ -33,38 +81,78 @@ void UpdateData::AddOutOfRangeGUID(ObjectGuid guid)
     m_outOfRangeGUIDs.insert(guid);
 }
 
-void UpdateData::AddUpdateBlock(const ByteBuffer &block)
+ByteBuffer& UpdateData::AddUpdateBlock()
 {
-    m_data.append(block);
+    if (m_data.empty())                                     // already handed over to a packet
+        m_data.resize(PacketHeaderSize);
+
     ++m_blockCount;
+    return m_data;
 }
 
 bool UpdateData::BuildPacket(WorldPacket* packet)
 {
     ASSERT(packet->empty());                                // shouldn't happen
-    packet->Initialize(SMSG_UPDATE_OBJECT, 2 + 4 + (m_outOfRangeGUIDs.empty() ? 0 : 1 + 4 + 9 * m_outOfRangeGUIDs.size()) + m_data.wpos());
+    if (m_data.empty())
+        m_data.resize(PacketHeaderSize);
 
-    *packet << uint32(m_blockCount);
-    *packet << uint16(m_map);
+    if (m_data.capacity() > m_initialCapacity)
+        GrownBuffers.fetch_add(1, std::memory_order_relaxed);
 
-    if (packet->WriteBit(!m_outOfRangeGUIDs.empty()))
+    std::size_t dataSize = m_data.size() - PacketHeaderSize;
+    if (m_outOfRangeGUIDs.empty())
     {
+        // header has fixed size, fill it in place and hand the whole buffer over to packet
+        m_data.put<uint32>(0, m_blockCount);
+        m_data.put<uint16>(4, m_map);
+        m_data.put<uint8>(6, 0);                            // has out of range objects bit
+        m_data.put<uint32>(7, dataSize);
+        *packet = WorldPacket(SMSG_UPDATE_OBJECT, std::move(m_data));
+    }
+    else
+    {
+        packet->Initialize(SMSG_UPDATE_OBJECT, 2 + 4 + 1 + 4 + 9 * m_outOfRangeGUIDs.size() + 4 + dataSize);
+
+        *packet << uint32(m_blockCount);
+        *packet << uint16(m_map);
+
+        packet->WriteBit(true);
         *packet << uint16(0);   // object limit to instantly destroy - objects before this index on m_outOfRangeGUIDs list get "smoothly phased out"
         *packet << uint32(m_outOfRangeGUIDs.size());
 
         for (GuidSet::const_iterator i = m_outOfRangeGUIDs.begin(); i != m_outOfRangeGUIDs.end(); ++i)
             *packet << *i;
+
+        *packet << uint32(dataSize);
+        if (dataSize)
+            packet->append(m_data.contents() + PacketHeaderSize, dataSize);
+
+        m_data.resize(PacketHeaderSize);
     }
 
-    *packet << uint32(m_data.size());
-    packet->append(m_data);
+    m_blockCount = 0;
+    m_outOfRangeGUIDs.clear();
     return true;
 }
 
 void UpdateData::Clear()
 {
-    m_data.clear();
+    m_data.resize(PacketHeaderSize);
     m_outOfRangeGUIDs.clear();
     m_blockCount = 0;
     m_map = 0;
 }
+
+void UpdateData::ReleaseBuffer(std::vector<uint8>&& buffer)
+{
+    if (!buffer.capacity() || buffer.capacity() > MaxCachedBufferCapacity || CachedBytes + buffer.capacity() > MaxCachedBytes)
+        return;
+
+    CachedBytes += buffer.capacity();
+    BufferCache.push_back(std::move(buffer));
+}
+
+UpdateData::BufferStats UpdateData::GetBufferStats()
+{
+    return { AllocatedBuffers.load(std::memory_order_relaxed), ReusedBuffers.load(std::memory_order_relaxed), GrownBuffers.load(std::memory_order_relaxed) };
+}
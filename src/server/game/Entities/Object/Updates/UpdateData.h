@@ -60,27 +60,43 @@ enum OBJECT_UPDATE_FLAGS
 class UpdateData
 {
     public:
+        // Counters of update data buffer allocations, in steady state buffers are only reused
+        struct BufferStats
+        {
+            uint64 Allocated;   // no cached buffer was available
+            uint64 Reused;      // buffer taken from cache
+            uint64 Grown;       // buffer had to grow while serializing update blocks
+        };
+
         UpdateData(uint32 map);
         UpdateData(UpdateData&& right) : m_map(right.m_map), m_blockCount(right.m_blockCount),
             m_outOfRangeGUIDs(std::move(right.m_outOfRangeGUIDs)),
-            m_data(std::move(right.m_data))
+            m_data(std::move(right.m_data)), m_initialCapacity(right.m_initialCapacity)
         {
         }
+        ~UpdateData();
 
         void AddOutOfRangeGUID(GuidSet& guids);
         void AddOutOfRangeGUID(ObjectGuid guid);
-        void AddUpdateBlock(const ByteBuffer &block);
+        // update blocks are serialized directly into returned buffer
+        ByteBuffer& AddUpdateBlock();
+        // moves serialized data into packet when possible, leaves update data empty
         bool BuildPacket(WorldPacket* packet);
         bool HasData() const { return m_blockCount > 0 || !m_outOfRangeGUIDs.empty(); }
         void Clear();
 
         GuidSet const& GetOutOfRangeGUIDs() const { return m_outOfRangeGUIDs; }
 
+        // returns storage of a sent packet to buffer cache of current thread
+        static void ReleaseBuffer(std::vector<uint8>&& buffer);
+        static BufferStats GetBufferStats();
+
     protected:
         uint32 m_map;
         uint32 m_blockCount;
         GuidSet m_outOfRangeGUIDs;
         ByteBuffer m_data;
+        std::size_t m_initialCapacity;
 
         UpdateData(UpdateData const& right) = delete;
         UpdateData& operator=(UpdateData const& right) = delete;
@@ -5119,3 +5119,21 @@ uint32 ConversationDynamicUpdateFieldFlags[CONVERSATION_DYNAMIC_END] =
     UF_FLAG_PUBLIC,                                         // CONVERSATION_DYNAMIC_FIELD_ACTORS
     UF_FLAG_0x100,                                          // CONVERSATION_DYNAMIC_FIELD_LINES
 };
+
+UpdateFieldFlagMasks::UpdateFieldFlagMasks(uint32 const* flags, std::size_t count) : _blocks((count + 31) / 32)
+{
+    for (std::size_t index = 0; index < count; ++index)
+        for (std::size_t flag = 0; flag < FlagCount; ++flag)
+            if (flags[index] & (1 << flag))
+                _blocks[index / 32][flag] |= 1 << (index % 32);
+}
+
+// must be defined after flag tables
+UpdateFieldFlagMasks const ItemUpdateFieldFlagMasks(ItemUpdateFieldFlags, CONTAINER_END);
+UpdateFieldFlagMasks const UnitUpdateFieldFlagMasks(UnitUpdateFieldFlags, PLAYER_END);
+UpdateFieldFlagMasks const GameObjectUpdateFieldFlagMasks(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+UpdateFieldFlagMasks const DynamicObjectUpdateFieldFlagMasks(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+UpdateFieldFlagMasks const CorpseUpdateFieldFlagMasks(CorpseUpdateFieldFlags, CORPSE_END);
+UpdateFieldFlagMasks const AreaTriggerUpdateFieldFlagMasks(AreaTriggerUpdateFieldFlags, AREATRIGGER_END);
+UpdateFieldFlagMasks const SceneObjectUpdateFieldFlagMasks(SceneObjectUpdateFieldFlags, SCENEOBJECT_END);
+UpdateFieldFlagMasks const ConversationUpdateFieldFlagMasks(ConversationUpdateFieldFlags, CONVERSATION_END);
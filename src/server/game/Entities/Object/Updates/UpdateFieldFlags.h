@@ -20,6 +20,9 @@
 
 #include "UpdateFields.h"
 #include "Define.h"
+#include <array>
+#include <bit>
+#include <vector>
 
 enum UpdatefieldFlags
 {
@@ -50,4 +53,39 @@ TC_GAME_API extern uint32 SceneObjectUpdateFieldFlags[SCENEOBJECT_END];
 TC_GAME_API extern uint32 ConversationUpdateFieldFlags[CONVERSATION_END];
 TC_GAME_API extern uint32 ConversationDynamicUpdateFieldFlags[CONVERSATION_DYNAMIC_END];
 
+// Fields of an update field flags table grouped by flag, packed in 32 field blocks using the same layout as update masks
+// Allows selecting fields visible to a target a whole block at a time instead of testing flags of every field
+class TC_GAME_API UpdateFieldFlagMasks
+{
+public:
+    UpdateFieldFlagMasks(uint32 const* flags, std::size_t count);
+
+    // Returns fields in given block that have any of the flags
+    uint32 GetBlock(uint32 flags, std::size_t block) const
+    {
+        std::array<uint32, FlagCount> const& masks = _blocks[block];
+        uint32 fields = 0;
+        for (uint32 flag = flags & ((1 << FlagCount) - 1); flag; flag &= flag - 1)
+            fields |= masks[std::countr_zero(flag)];
+
+        return fields;
+    }
+
+    std::size_t GetBlockCount() const { return _blocks.size(); }
+
+private:
+    static constexpr std::size_t FlagCount = 11;
+
+    std::vector<std::array<uint32, FlagCount>> _blocks;
+};
+
+TC_GAME_API extern UpdateFieldFlagMasks const ItemUpdateFieldFlagMasks;
+TC_GAME_API extern UpdateFieldFlagMasks const UnitUpdateFieldFlagMasks;
+TC_GAME_API extern UpdateFieldFlagMasks const GameObjectUpdateFieldFlagMasks;
+TC_GAME_API extern UpdateFieldFlagMasks const DynamicObjectUpdateFieldFlagMasks;
+TC_GAME_API extern UpdateFieldFlagMasks const CorpseUpdateFieldFlagMasks;
+TC_GAME_API extern UpdateFieldFlagMasks const AreaTriggerUpdateFieldFlagMasks;
+TC_GAME_API extern UpdateFieldFlagMasks const SceneObjectUpdateFieldFlagMasks;
+TC_GAME_API extern UpdateFieldFlagMasks const ConversationUpdateFieldFlagMasks;
+
 #endif // _UPDATEFIELDFLAGS_H
@@ -1059,6 +1059,7 @@ void Player::Update(uint32 p_time)
     }
 
     m_achievementMgr->UpdateTimedCriteria(Milliseconds(p_time));
+    m_achievementMgr->PruneOpenCriteria();
 
     DoMeleeAttackIfReady();
 
@@ -6061,6 +6062,11 @@ void Player::SendDirectMessage(WorldPacket const* data) const
     m_session->SendPacket(data);
 }
 
+void Player::SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const
+{
+    m_session->SendPacket(data);
+}
+
 void Player::SendCinematicStart(uint32 CinematicSequenceId) const
 {
     WorldPackets::Misc::TriggerCinematic packet;
@@ -14726,7 +14732,7 @@ void Player::RewardQuest(Quest const* quest, LootItemType rewardType, uint32 rew
 
     bool updateVisibility = false;
     if (quest->HasFlag(QUEST_FLAGS_UPDATE_PHASESHIFT))
-        updateVisibility = PhasingHandler::OnConditionChange(this, false);
+        updateVisibility = PhasingHandler::OnConditionChange(this, false);  // rewards can change level, reputation, items and auras too
 
     //lets remove flag for delayed teleports
     SetCanDelayTeleport(false);
@@ -15632,7 +15638,7 @@ QuestGiverStatus Player::GetQuestDialogStatus(Object const* questgiver) const
 
 void Player::SkipQuests(std::vector<uint32> const& questIds)
 {
-    bool updateVisibility = false;
+    bool updatePhaseShift = false;
     for (uint32 const& questId : questIds)
     {
         Quest const* quest = sObjectMgr->GetQuestTemplate(questId);
@@ -15662,13 +15668,16 @@ void Player::SkipQuests(std::vector<uint32> const& questIds)
         SetRewardedQuest(questId);
         SendQuestUpdate(questId);
 
-        if (!updateVisibility && quest->HasFlag(QUEST_FLAGS_UPDATE_PHASESHIFT))
-            updateVisibility = PhasingHandler::OnConditionChange(this, false);
+        if (quest->HasFlag(QUEST_FLAGS_UPDATE_PHASESHIFT))
+            updatePhaseShift = true;
 
         sScriptMgr->OnQuestStatusChange(this, questId);
         sScriptMgr->OnQuestStatusChange(this, quest, oldStatus, QUEST_STATUS_REWARDED);
     }
 
+    // re-evaluate all phases once every quest is rewarded
+    bool updateVisibility = updatePhaseShift && PhasingHandler::OnConditionChange(this, false);
+
     SendQuestGiverStatusMultiple();
 
     // make full db save
@@ -15990,7 +15999,8 @@ void Player::UpdateQuestObjectiveProgress(QuestObjectiveType objectiveType, int3
     std::vector<QuestObjective const*>* updatedObjectives /*= nullptr*/, std::function<bool(QuestObjective const*)> const* objectiveFilter /*= nullptr*/)
 {
     bool anyObjectiveChangedCompletionState = false;
-    bool updatePhaseShift = false;
+    std::vector<uint32> phaseShiftQuestIds;
+    bool updateAllPhases = false;
     bool updateZoneAuras = false;
 
     for (QuestObjectiveStatusMap::value_type const& objectiveItr : Trinity::Containers::MapEqualRange(m_questObjectiveStatus, { objectiveType, objectId }))
@@ -16115,7 +16125,12 @@ void Player::UpdateQuestObjectiveProgress(QuestObjectiveType objectiveType, int3
             if (objective->CompletionEffect->ConversationId)
                 Conversation::CreateConversation(*objective->CompletionEffect->ConversationId, this, GetPosition(), GetGUID());
             if (objective->CompletionEffect->UpdatePhaseShift)
-                updatePhaseShift = true;
+            {
+                phaseShiftQuestIds.push_back(questId);
+                // auras and game events are not quest dependencies, phases conditioned on them need a full re-evaluation
+                if (objective->CompletionEffect->SpellId || objective->CompletionEffect->GameEventId)
+                    updateAllPhases = true;
+            }
             if (objective->CompletionEffect->UpdateZoneAuras)
                 updateZoneAuras = true;
         }
@@ -16138,8 +16153,10 @@ void Player::UpdateQuestObjectiveProgress(QuestObjectiveType objectiveType, int3
     if (anyObjectiveChangedCompletionState)
         UpdateVisibleGameobjectsOrSpellClicks();
 
-    if (updatePhaseShift)
+    if (updateAllPhases)
         PhasingHandler::OnConditionChange(this);
+    else if (!phaseShiftQuestIds.empty())
+        PhasingHandler::OnQuestStatusChange(this, phaseShiftQuestIds);
 
     if (updateZoneAuras)
     {
@@ -1762,6 +1762,8 @@ class TC_GAME_API Unit : public WorldObject
         std::array<AuraEffectList, TOTAL_AURAS> m_modAuras;
         AuraList m_scAuras;                        // cast singlecast auras
         AuraApplicationList m_interruptableAuras;  // auras which have interrupt mask applied on unit
+        std::vector<AuraApplication*> m_procAuras; // auras with spell_proc entry, in m_appliedAuras order
+        uint32 m_procAurasGeneration;              // SpellMgr::GetSpellProcsGeneration when m_procAuras was built
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
         EnumFlag<SpellAuraInterruptFlags> m_interruptMask;
         EnumFlag<SpellAuraInterruptFlags2> m_interruptMask2;
@@ -1840,6 +1842,9 @@ class TC_GAME_API Unit : public WorldObject
 
         Diminishing m_Diminishing;
 
+        void AddProcAura(AuraApplication* aurApp);
+        void RebuildProcAuras();
+
         // Threat+combat management
         friend class CombatManager;
         CombatManager m_combatManager;
@@ -256,11 +256,10 @@ MessageDistDeliverer::VisitObject(Player* player)
 */
 
 template<class T>
-void ObjectUpdater::Visit(GridRefManager<T> &m)
+void ObjectUpdateCollector::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
-        if (iter->GetSource()->IsInWorld())
-            iter->GetSource()->Update(i_timeDiff);
+        i_objects.push_back(iter->GetSource());
 }
 
 bool AnyDeadUnitObjectInRangeCheck::operator()(Player* u)
@@ -293,9 +292,9 @@ bool AnyDeadUnitSpellTargetInRangeCheck::operator()(Creature* u)
     return AnyDeadUnitObjectInRangeCheck::operator()(u) && WorldObjectSpellTargetCheck::operator()(u);
 }
 
-template void ObjectUpdater::Visit<Creature>(CreatureMapType&);
-template void ObjectUpdater::Visit<GameObject>(GameObjectMapType&);
-template void ObjectUpdater::Visit<DynamicObject>(DynamicObjectMapType&);
-template void ObjectUpdater::Visit<AreaTrigger>(AreaTriggerMapType &);
-template void ObjectUpdater::Visit<SceneObject>(SceneObjectMapType &);
-template void ObjectUpdater::Visit<Conversation>(ConversationMapType &);
+template void ObjectUpdateCollector::Visit<Creature>(CreatureMapType&);
+template void ObjectUpdateCollector::Visit<GameObject>(GameObjectMapType&);
+template void ObjectUpdateCollector::Visit<DynamicObject>(DynamicObjectMapType&);
+template void ObjectUpdateCollector::Visit<AreaTrigger>(AreaTriggerMapType &);
+template void ObjectUpdateCollector::Visit<SceneObject>(SceneObjectMapType &);
+template void ObjectUpdateCollector::Visit<Conversation>(ConversationMapType &);
@@ -130,15 +130,20 @@ namespace Trinity
         void Visit(ConversationMapType &m) { updateObjects<Conversation>(m); }
     };
 
+    // Packet senders copy the packet once for first receiver and share that copy with all other receivers
     struct PacketSenderRef
     {
         WorldPacket const* Data;
+        mutable std::shared_ptr<WorldPacket const> SharedData;
 
         PacketSenderRef(WorldPacket const* message) : Data(message) { }
 
         void operator()(Player const* player) const
         {
-            player->SendDirectMessage(Data);
+            if (!SharedData)
+                SharedData = std::make_shared<WorldPacket const>(*Data);
+
+            player->SendDirectMessage(SharedData);
         }
     };
 
@@ -146,10 +151,14 @@ namespace Trinity
     struct PacketSenderOwning
     {
         Packet Data;
+        mutable std::shared_ptr<WorldPacket const> SharedData;
 
         void operator()(Player const* player) const
         {
-            player->SendDirectMessage(Data.GetRawPacket());
+            if (!SharedData)
+                SharedData = std::make_shared<WorldPacket const>(*Data.GetRawPacket());
+
+            player->SendDirectMessage(SharedData);
         }
     };
 
@@ -220,10 +229,11 @@ namespace Trinity
         }
     };
 
-    struct ObjectUpdater
+    // gathers the objects of a cell so they can be updated from a flat array, players and corpses are updated separately
+    struct ObjectUpdateCollector
     {
-        uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff) { }
+        std::vector<WorldObject*>& i_objects;
+        explicit ObjectUpdateCollector(std::vector<WorldObject*>& objects) : i_objects(objects) { }
         template<class T> void Visit(GridRefManager<T> &m);
         void Visit(PlayerMapType &) { }
         void Visit(CorpseMapType &) { }
@@ -24,6 +24,7 @@
 #include "Formulas.h"
 #include "GameObject.h"
 #include "GameTime.h"
+#include "GridNotifiers.h"
 #include "GroupMgr.h"
 #include "Item.h"
 #include "LFGMgr.h"
@@ -985,6 +986,7 @@ void Group::BroadcastAddonMessagePacket(WorldPacket const* packet, const std::st
 
 void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignoredPlayer) const
 {
+    Trinity::PacketSenderRef sender(packet);
     for (GroupReference const* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player const* player = itr->GetSource();
@@ -992,7 +994,7 @@ void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRai
             continue;
 
         if (group == -1 || itr->getSubGroup() == group)
-            player->SendDirectMessage(packet);
+            sender(player);
     }
 }
 
@@ -26,6 +26,7 @@
 #include "Config.h"
 #include "DatabaseEnv.h"
 #include "DB2Stores.h"
+#include "GridNotifiers.h"
 #include "GuildFinderMgr.h"
 #include "GameTime.h"
 #include "GuildMgr.h"
@@ -2108,6 +2109,7 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->SetStats(player);
         member->UpdateLogoutTime();
         member->ResetFlags();
+        m_onlineMembers.erase(std::remove(m_onlineMembers.begin(), m_onlineMembers.end(), member), m_onlineMembers.end());
     }
 
     SendEventPresenceChanged(session, false, true);
@@ -2306,6 +2308,8 @@ void Guild::SendLoginInfo(WorldSession* session)
     player->GetSession()->SendPacket(packet.Write());
 
     member->SetStats(player);
+    if (!member->IsOnline())
+        m_onlineMembers.push_back(member);
     member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
 }
 
@@ -2631,12 +2635,12 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPackets::Chat::Chat packet;
         packet.Initialize(officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
-        WorldPacket const* data = packet.Write();
-        for (auto const& [guid, member] : m_members)
-            if (Player* player = member.FindConnectedPlayer())
+        Trinity::PacketSenderRef sender(packet.Write());
+        for (Member const* member : m_onlineMembers)
+            if (Player* player = member->FindConnectedPlayer())
                 if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
                     !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID(), session->GetAccountGUID()))
-                    player->SendDirectMessage(data);
+                    sender(player);
     }
 }
 
@@ -2646,29 +2650,31 @@ void Guild::BroadcastAddonToGuild(WorldSession* session, bool officerOnly, std::
     {
         WorldPackets::Chat::Chat packet;
         packet.Initialize(officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, LANG_ADDON, session->GetPlayer(), nullptr, msg, 0, "", DEFAULT_LOCALE, prefix);
-        WorldPacket const* data = packet.Write();
-        for (auto const& [guid, member] : m_members)
-            if (Player* player = member.FindPlayer())
+        Trinity::PacketSenderRef sender(packet.Write());
+        for (Member const* member : m_onlineMembers)
+            if (Player* player = member->FindPlayer())
                 if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
                     !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID(), session->GetAccountGUID()) &&
                     player->GetSession()->IsAddonRegistered(prefix))
-                        player->SendDirectMessage(data);
+                        sender(player);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, GuildRankId rankId) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (member.IsRank(rankId))
-            if (Player* player = member.FindConnectedPlayer())
-                player->SendDirectMessage(packet);
+    Trinity::PacketSenderRef sender(packet);
+    for (Member const* member : m_onlineMembers)
+        if (member->IsRank(rankId))
+            if (Player* player = member->FindConnectedPlayer())
+                sender(player);
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (Player* player = member.FindConnectedPlayer())
-            player->SendDirectMessage(packet);
+    Trinity::PacketSenderRef sender(packet);
+    for (Member const* member : m_onlineMembers)
+        if (Player* player = member->FindConnectedPlayer())
+            sender(player);
 }
 
 std::vector<Player*> Guild::GetMembersTrackingCriteria(uint32 criteriaId) const
@@ -2841,6 +2847,9 @@ void Guild::DeleteMember(CharacterDatabaseTransaction trans, ObjectGuid guid, bo
     // Call script on remove before member is actually removed from guild (and database)
     sScriptMgr->OnGuildRemoveMember(this, guid, isDisbanding, isKicked);
 
+    if (Member const* member = GetMember(guid))
+        m_onlineMembers.erase(std::remove(m_onlineMembers.begin(), m_onlineMembers.end(), member), m_onlineMembers.end());
+
     m_members.erase(guid);
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
@@ -812,8 +812,8 @@ class TC_GAME_API Guild
         template<class Do>
         void BroadcastWorker(Do& _do, Player* except = nullptr)
         {
-            for (auto itr = m_members.begin(); itr != m_members.end(); ++itr)
-                if (Player* player = itr->second.FindConnectedPlayer())
+            for (Member const* member : m_onlineMembers)
+                if (Player* player = member->FindConnectedPlayer())
                     if (player != except)
                         _do(player);
         }
@@ -863,6 +863,7 @@ class TC_GAME_API Guild
 
         std::vector<RankInfo> m_ranks;
         std::unordered_map<ObjectGuid, Member> m_members;
+        std::vector<Member const*> m_onlineMembers;             // members with GUILDMEMBER_STATUS_ONLINE, broadcasts skip everyone else
         std::vector<BankTab> m_bankTabs;
 
         // These are actually ordered lists. The first element is the oldest entry.
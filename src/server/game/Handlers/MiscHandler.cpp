@@ -56,7 +56,9 @@
 #include "WhoListStorage.h"
 #include "WhoPackets.h"
 #include "World.h"
+#include <algorithm>
 #include <cstdarg>
+#include <unordered_map>
 #include <zlib.h>
 
 void WorldSession::HandleRepopRequest(WorldPackets::Misc::RepopRequest& /*packet*/)
@@ -143,6 +145,9 @@ void WorldSession::HandleWhoOpcode(WorldPackets::Who::WhoRequestPkt& whoRequest)
 
     WorldPackets::Who::WhoResponsePkt response;
 
+    // area names are converted and matched against words once per zone instead of once per player
+    std::unordered_map<uint32, bool> zoneMatchesWords;
+
     WhoListInfoVector const& whoList = sWhoListStorageMgr->GetWhoList();
     for (WhoListPlayerInfo const& target : whoList)
     {
@@ -189,18 +194,13 @@ void WorldSession::HandleWhoOpcode(WorldPackets::Who::WhoRequestPkt& whoRequest)
 
         if (!wWords.empty())
         {
-            std::string aName;
-            if (AreaTableEntry const* areaEntry = sAreaTableStore.LookupEntry(target.GetZoneId()))
-                aName = areaEntry->AreaName[GetSessionDbcLocale()];
-
             bool show = false;
             for (size_t i = 0; i < wWords.size(); ++i)
             {
                 if (!wWords[i].empty())
                 {
                     if (wTargetName.find(wWords[i]) != std::wstring::npos ||
-                        wTargetGuildName.find(wWords[i]) != std::wstring::npos ||
-                        Utf8FitTo(aName, wWords[i]))
+                        wTargetGuildName.find(wWords[i]) != std::wstring::npos)
                     {
                         show = true;
                         break;
@@ -208,6 +208,24 @@ void WorldSession::HandleWhoOpcode(WorldPackets::Who::WhoRequestPkt& whoRequest)
                 }
             }
 
+            if (!show)
+            {
+                auto [zoneItr, isNew] = zoneMatchesWords.try_emplace(target.GetZoneId(), false);
+                if (isNew)
+                {
+                    std::string aName;
+                    if (AreaTableEntry const* areaEntry = sAreaTableStore.LookupEntry(target.GetZoneId()))
+                        aName = areaEntry->AreaName[GetSessionDbcLocale()];
+
+                    zoneItr->second = std::any_of(wWords.begin(), wWords.end(), [&](std::wstring const& word)
+                    {
+                        return !word.empty() && Utf8FitTo(aName, word);
+                    });
+                }
+
+                show = zoneItr->second;
+            }
+
             if (!show)
                 continue;
         }
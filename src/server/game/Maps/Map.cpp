@@ -60,6 +60,7 @@
 #include "WorldSession.h"
 #include "WorldStateMgr.h"
 #include "WorldStatePackets.h"
+#include <algorithm>
 #include <boost/heap/fibonacci_heap.hpp>
 #include <sstream>
 
@@ -144,7 +145,8 @@ m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
 i_gridExpiry(expiry), m_terrain(sTerrainMgr.LoadTerrain(id)), m_forceEnabledNavMeshFilterFlags(0), m_forceDisabledNavMeshFilterFlags(0),
-i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0)
+i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0),
+_procAurasTested(0), _procAurasTriggered(0)
 {
     for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
     {
@@ -619,7 +621,7 @@ bool Map::IsGridLoaded(GridCoord const& p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+void Map::MarkNearbyCellsOf(WorldObject const* obj)
 {
     // Check for valid position
     if (!obj->IsPositionValid())
@@ -639,15 +641,129 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
                 continue;
 
             markCell(cell_id);
-            CellCoord pair(x, y);
-            Cell cell(pair);
-            cell.SetNoCreate();
-            Visit(cell, gridVisitor);
-            Visit(cell, worldVisitor);
+            _activeCells.push_back(cell_id);
         }
     }
 }
 
+void Map::MarkCellsNearPlayer(WorldObject const* obj, float distance)
+{
+    if (!obj->IsPositionValid())
+        return;
+
+    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), distance);
+
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+            _nearPlayerCells.push_back((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
+}
+
+void Map::UpdateActiveCells(uint32 diff)
+{
+    // visit cells in id order so that neighbouring cells of the same grid are updated together
+    std::sort(_activeCells.begin(), _activeCells.end());
+
+    // creatures outside of the cells near players may be updated at a reduced rate
+    bool const reducedUpdateRate = sWorld->getFloatConfig(CONFIG_CREATURE_UPDATE_LOD_DISTANCE) > 0.0f;
+    uint32 const reducedUpdateInterval = sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_INTERVAL);
+    uint32 const maxReducedUpdates = sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_MAX_UPDATES);
+    if (reducedUpdateRate)
+    {
+        std::sort(_nearPlayerCells.begin(), _nearPlayerCells.end());
+        _nearPlayerCells.erase(std::unique(_nearPlayerCells.begin(), _nearPlayerCells.end()), _nearPlayerCells.end());
+    }
+
+    std::vector<uint32>::const_iterator nearPlayerCell = _nearPlayerCells.begin();
+    uint32 reducedUpdates = 0;
+    uint32 skippedUpdates = 0;
+
+    Trinity::ObjectUpdateCollector collector(_cellUpdateObjects);
+    TypeContainerVisitor<Trinity::ObjectUpdateCollector, GridTypeMapContainer> gridCollector(collector);
+    TypeContainerVisitor<Trinity::ObjectUpdateCollector, WorldTypeMapContainer> worldCollector(collector);
+
+    uint32 updatedCells = 0;
+    uint32 updatedObjects = 0;
+    for (uint32 cell_id : _activeCells)
+    {
+        CellCoord pair(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+        Cell cell(pair);
+        if (!IsGridLoaded(GridCoord(cell.GridX(), cell.GridY())))
+            continue;
+
+        NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
+        grid->VisitGrid(cell.CellX(), cell.CellY(), gridCollector);
+        grid->VisitGrid(cell.CellX(), cell.CellY(), worldCollector);
+        if (_cellUpdateObjects.empty())
+            continue;
+
+        // both lists are sorted, advance to the first near cell not lower than this one
+        while (nearPlayerCell != _nearPlayerCells.end() && *nearPlayerCell < cell_id)
+            ++nearPlayerCell;
+
+        bool const farFromPlayers = reducedUpdateRate && (nearPlayerCell == _nearPlayerCells.end() || *nearPlayerCell != cell_id);
+
+        // objects are never deleted during updates (they go through the remove list), so the collected pointers stay valid
+        for (WorldObject* obj : _cellUpdateObjects)
+        {
+            if (!obj->IsInWorld())
+                continue;
+
+            uint32 objectDiff = diff;
+            if (Creature* creature = obj->ToCreature())
+            {
+                objectDiff += creature->GetSkippedUpdateDiff();
+                if (farFromPlayers && creature->CanUseReducedUpdateRate())
+                {
+                    // over budget creatures are postponed, but never for more than twice the interval
+                    if (objectDiff < reducedUpdateInterval
+                        || (maxReducedUpdates && reducedUpdates >= maxReducedUpdates && objectDiff < 2 * reducedUpdateInterval))
+                    {
+                        creature->SetSkippedUpdateDiff(objectDiff);
+                        ++skippedUpdates;
+                        continue;
+                    }
+
+                    ++reducedUpdates;
+                }
+
+                creature->SetSkippedUpdateDiff(0);
+            }
+
+            obj->Update(objectDiff);
+            ++updatedObjects;
+        }
+
+        ++updatedCells;
+        _cellUpdateObjects.clear();
+    }
+
+    TC_METRIC_VALUE("map_active_cells", uint64(_activeCells.size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_updated_cells", updatedCells,
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_updated_objects", updatedObjects,
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (reducedUpdateRate)
+    {
+        TC_METRIC_VALUE("map_creatures_reduced_updates", reducedUpdates,
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        TC_METRIC_VALUE("map_creatures_skipped_updates", skippedUpdates,
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+
+    _activeCells.clear();
+    _nearPlayerCells.clear();
+}
+
 void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 {
     // Nothing to do if no change
@@ -666,6 +782,7 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 void Map::Update(uint32 t_diff)
 {
     _dynamicTree.update(t_diff);
+
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -689,14 +806,10 @@ void Map::Update(uint32 t_diff)
     else
         _respawnCheckTimer -= t_diff;
 
-    /// update active cells around players and active objects
+    /// collect active cells around players and active objects, each cell is updated once after all of them are known
     resetMarkedCells();
 
-    Trinity::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+    float const nearPlayerDistance = sWorld->getFloatConfig(CONFIG_CREATURE_UPDATE_LOD_DISTANCE);
 
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
@@ -710,11 +823,17 @@ void Map::Update(uint32 t_diff)
         // update players at tick
         player->Update(t_diff);
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+        MarkNearbyCellsOf(player);
+        if (nearPlayerDistance > 0.0f)
+            MarkCellsNearPlayer(player, nearPlayerDistance);
 
         // If player is using far sight or mind vision, visit that object too
         if (WorldObject* viewPoint = player->GetViewpoint())
-            VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+        {
+            MarkNearbyCellsOf(viewPoint);
+            if (nearPlayerDistance > 0.0f)
+                MarkCellsNearPlayer(viewPoint, nearPlayerDistance);
+        }
 
         // Handle updates for creatures in combat with player and are more than 60 yards away
         if (player->IsInCombat())
@@ -725,7 +844,7 @@ void Map::Update(uint32 t_diff)
                     if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
                         toVisit.push_back(unit);
             for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+                MarkNearbyCellsOf(unit);
         }
 
         { // Update any creatures that own auras the player has applications of
@@ -737,7 +856,7 @@ void Map::Update(uint32 t_diff)
                         toVisit.insert(caster);
             }
             for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+                MarkNearbyCellsOf(unit);
         }
 
         { // Update player's summons
@@ -751,7 +870,7 @@ void Map::Update(uint32 t_diff)
                             toVisit.push_back(unit);
 
             for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+                MarkNearbyCellsOf(unit);
         }
     }
 
@@ -764,9 +883,11 @@ void Map::Update(uint32 t_diff)
         if (!obj || !obj->IsInWorld())
             continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+        MarkNearbyCellsOf(obj);
     }
 
+    UpdateActiveCells(t_diff);
+
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
     {
         WorldObject* obj = *_transportsUpdateIter;
@@ -813,6 +934,17 @@ void Map::Update(uint32 t_diff)
     TC_METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         TC_METRIC_TAG("map_id", std::to_string(GetId())),
         TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_proc_auras_tested", uint64(_procAurasTested),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_proc_auras_triggered", uint64(_procAurasTriggered),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _procAurasTested = 0;
+    _procAurasTriggered = 0;
 }
 
 struct ResetNotifier
@@ -1938,12 +2070,12 @@ void Map::SendObjectUpdates()
         obj->BuildUpdate(update_players);
     }
 
-    WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
+    WorldPacket packet;
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
-        iter->second.BuildPacket(&packet);
+        iter->second.BuildPacket(&packet);                  // takes over update data buffer
         iter->first->SendDirectMessage(&packet);
-        packet.clear();                                     // clean the string
+        UpdateData::ReleaseBuffer(packet.Move());           // and gives it back for next update
     }
 }
 
@@ -2656,8 +2788,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    Trinity::PacketSenderRef sender(data);
     for (MapRefManager::const_iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
-        itr->GetSource()->SendDirectMessage(data);
+        sender(itr->GetSource());
 }
 
 bool Map::ActiveObjectsNearGrid(NGridType const& ngrid) const
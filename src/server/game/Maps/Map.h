@@ -77,7 +77,6 @@ enum Difficulty : uint8;
 enum WeatherState : uint32;
 enum class ItemContext : uint8;
 
-namespace Trinity { struct ObjectUpdater; }
 namespace VMAP { enum class ModelIgnoreFlags : uint32; }
 
 enum TransferAbortReason : uint32
@@ -211,7 +210,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         template<class T> bool AddToMap(T *);
         template<class T> void RemoveFromMap(T *, bool);
 
-        void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
+        void MarkNearbyCellsOf(WorldObject const* obj);
+        void MarkCellsNearPlayer(WorldObject const* obj, float distance);
+        void UpdateActiveCells(uint32 diff);
         virtual void Update(uint32);
 
         float GetVisibilityRange() const { return m_VisibleDistance; }
@@ -418,6 +419,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         MapStoredObjectTypesContainer& GetObjectsStore() { return _objectsStore; }
 
+        // auras tested for procs and auras triggered by units of this map since last update, reported as metrics
+        void AddProcAuraStatistics(uint32 tested, uint32 triggered) { _procAurasTested += tested; _procAurasTriggered += triggered; }
+
         typedef std::unordered_multimap<ObjectGuid::LowType, Creature*> CreatureBySpawnIdContainer;
         CreatureBySpawnIdContainer& GetCreatureBySpawnIdStore() { return _creatureBySpawnIdStore; }
         CreatureBySpawnIdContainer const& GetCreatureBySpawnIdStore() const { return _creatureBySpawnIdStore; }
@@ -638,11 +642,15 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         time_t i_gridExpiry;
 
         std::shared_ptr<TerrainInfo> m_terrain;
+
         uint16 m_forceEnabledNavMeshFilterFlags;
         uint16 m_forceDisabledNavMeshFilterFlags;
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        std::vector<uint32> _activeCells;                   // ids of the cells marked in marked_cells during this update
+        std::vector<WorldObject*> _cellUpdateObjects;       // objects of the cell currently being updated
+        std::vector<uint32> _nearPlayerCells;               // ids of the cells where creatures are always updated at full rate
 
         //these functions used to process player/mob aggro reactions and
         //visibility calculations. Highly optimized for massive calculations
@@ -782,6 +790,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::unordered_set<uint32> _toggledSpawnGroupIds;
 
         uint32 _respawnCheckTimer;
+        uint32 _procAurasTested;
+        uint32 _procAurasTriggered;
         std::unordered_map<uint32, uint32> _zonePlayerCountMap;
 
         ZoneDynamicInfoMap _zoneDynamicInfo;
@@ -365,7 +365,8 @@ void PhasingHandler::OnAreaChange(WorldObject* object)
     UpdateVisibilityIfNeeded(object, true, changed);
 }
 
-bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibility /*= true*/)
+template<typename ConditionsFilter, typename TerrainSwapFilter>
+bool PhasingHandler::UpdateConditionalPhases(WorldObject* object, bool updateVisibility, ConditionsFilter isAffected, TerrainSwapFilter isTerrainSwapAffected)
 {
     PhaseShift& phaseShift = object->GetPhaseShift();
     PhaseShift& suppressedPhaseShift = object->GetSuppressedPhaseShift();
@@ -375,7 +376,7 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
 
     for (auto itr = phaseShift.Phases.begin(); itr != phaseShift.Phases.end();)
     {
-        if (itr->AreaConditions && !sConditionMgr->IsObjectMeetToConditions(srcInfo, *itr->AreaConditions))
+        if (itr->AreaConditions && isAffected(*itr->AreaConditions) && !sConditionMgr->IsObjectMeetToConditions(srcInfo, *itr->AreaConditions))
         {
             newSuppressions.AddPhase(itr->Id, itr->Flags, itr->AreaConditions, itr->References);
             phaseShift.ModifyPhasesReferences(itr, -itr->References);
@@ -387,7 +388,7 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
 
     for (auto itr = suppressedPhaseShift.Phases.begin(); itr != suppressedPhaseShift.Phases.end();)
     {
-        if (sConditionMgr->IsObjectMeetToConditions(srcInfo, *ASSERT_NOTNULL(itr->AreaConditions)))
+        if (isAffected(*ASSERT_NOTNULL(itr->AreaConditions)) && sConditionMgr->IsObjectMeetToConditions(srcInfo, *itr->AreaConditions))
         {
             changed = phaseShift.AddPhase(itr->Id, itr->Flags, itr->AreaConditions, itr->References) || changed;
             suppressedPhaseShift.ModifyPhasesReferences(itr, -itr->References);
@@ -399,7 +400,7 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
 
     for (auto itr = phaseShift.VisibleMapIds.begin(); itr != phaseShift.VisibleMapIds.end();)
     {
-        if (!sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
+        if (isTerrainSwapAffected(itr->first) && !sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
         {
             newSuppressions.AddVisibleMapId(itr->first, itr->second.VisibleMapInfo, itr->second.References);
             for (uint32 uiWorldMapAreaIdSwap : itr->second.VisibleMapInfo->UiWorldMapAreaIDSwaps)
@@ -413,7 +414,7 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
 
     for (auto itr = suppressedPhaseShift.VisibleMapIds.begin(); itr != suppressedPhaseShift.VisibleMapIds.end();)
     {
-        if (sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
+        if (isTerrainSwapAffected(itr->first) && sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
         {
             changed = phaseShift.AddVisibleMapId(itr->first, itr->second.VisibleMapInfo, itr->second.References) || changed;
             for (uint32 uiWorldMapAreaIdSwap : itr->second.VisibleMapInfo->UiWorldMapAreaIDSwaps)
@@ -481,6 +482,27 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
     return changed;
 }
 
+bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibility /*= true*/)
+{
+    return UpdateConditionalPhases(object, updateVisibility,
+        [](std::vector<Condition> const& /*conditions*/) { return true; },
+        [](uint32 /*terrainSwapId*/) { return true; });
+}
+
+bool PhasingHandler::OnQuestStatusChange(WorldObject* object, std::span<uint32 const> questIds, bool updateVisibility /*= true*/)
+{
+    // only phases and terrain swaps whose conditions check one of the changed quests can change state
+    return UpdateConditionalPhases(object, updateVisibility,
+        [questIds](std::vector<Condition> const& conditions)
+        {
+            return std::any_of(questIds.begin(), questIds.end(), [&](uint32 questId) { return sConditionMgr->IsConditionListAffectedByQuest(conditions, questId); });
+        },
+        [questIds](uint32 terrainSwapId)
+        {
+            return std::any_of(questIds.begin(), questIds.end(), [&](uint32 questId) { return sConditionMgr->IsTerrainSwapAffectedByQuest(terrainSwapId, questId); });
+        });
+}
+
 void PhasingHandler::SendToPlayer(Player const* player, PhaseShift const& phaseShift)
 {
     WorldPackets::Misc::PhaseShiftChange phaseShiftChange;
@@ -19,6 +19,7 @@
 #define PhasingHandler_h__
 
 #include "Define.h"
+#include <span>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,7 @@ public:
     static void OnMapChange(WorldObject* object);
     static void OnAreaChange(WorldObject* object);
     static bool OnConditionChange(WorldObject* object, bool updateVisibility = true);
+    static bool OnQuestStatusChange(WorldObject* object, std::span<uint32 const> questIds, bool updateVisibility = true);
 
     static void SendToPlayer(Player const* player, PhaseShift const& phaseShift);
     static void SendToPlayer(Player const* player);
@@ -86,6 +88,9 @@ private:
     static void AddVisibleMapId(WorldObject* object, uint32 visibleMapId, ControlledUnitVisitor& visitor);
     static void RemoveVisibleMapId(WorldObject* object, uint32 visibleMapId, ControlledUnitVisitor& visitor);
     static void UpdateVisibilityIfNeeded(WorldObject* object, bool updateVisibility, bool changed);
+
+    template<typename ConditionsFilter, typename TerrainSwapFilter>
+    static bool UpdateConditionalPhases(WorldObject* object, bool updateVisibility, ConditionsFilter isAffected, TerrainSwapFilter isTerrainSwapAffected);
 };
 
 #endif // PhasingHandler_h__
@@ -0,0 +1,171 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "OpcodeProfiler.h"
+#include "Metric.h"
+#include "World.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+std::chrono::microseconds OpcodeProfiler::OpcodeStats::GetPercentile(float percentile) const
+{
+    if (!SampledCalls)
+        return std::chrono::microseconds::zero();
+
+    uint64 target = uint64(std::ceil(SampledCalls * percentile / 100.0f));
+    uint64 count = 0;
+    for (std::size_t i = 0; i < HistogramBuckets; ++i)
+    {
+        count += Histogram[i];
+        if (count >= target)
+            return std::chrono::microseconds(UI64LIT(1) << i);
+    }
+
+    return std::chrono::microseconds(UI64LIT(1) << (HistogramBuckets - 1));
+}
+
+bool OpcodeProfiler::SessionStats::AddSample(OpcodeClient opcode, std::chrono::nanoseconds estimatedTime, TimePoint now, Milliseconds threshold)
+{
+    if (now - _windowStart >= SessionWindow)
+    {
+        _windowStart = now;
+        _windowTime = std::chrono::nanoseconds::zero();
+        _reported = false;
+        _opcodeTimes.clear();
+    }
+
+    _windowTime += estimatedTime;
+    _opcodeTimes[opcode] += estimatedTime;
+
+    if (_reported || _windowTime < threshold)
+        return false;
+
+    _reported = true;
+    return true;
+}
+
+OpcodeClient OpcodeProfiler::SessionStats::GetMostExpensiveOpcode() const
+{
+    auto itr = std::max_element(_opcodeTimes.begin(), _opcodeTimes.end(), [](auto const& left, auto const& right) { return left.second < right.second; });
+    return itr != _opcodeTimes.end() ? itr->first : OpcodeClient(NULL_OPCODE);
+}
+
+OpcodeProfiler::OpcodeProfiler() : _counters(std::make_unique<Counters[]>(NUM_OPCODE_HANDLERS))
+{
+}
+
+OpcodeProfiler::~OpcodeProfiler() = default;
+
+OpcodeProfiler* OpcodeProfiler::instance()
+{
+    static OpcodeProfiler instance;
+    return &instance;
+}
+
+bool OpcodeProfiler::IsEnabled() const
+{
+    return sWorld->getBoolConfig(CONFIG_OPCODE_PROFILER_ENABLED);
+}
+
+uint32 OpcodeProfiler::GetSampleRate() const
+{
+    return sWorld->getIntConfig(CONFIG_OPCODE_PROFILER_SAMPLE_RATE);
+}
+
+Milliseconds OpcodeProfiler::GetSessionThreshold() const
+{
+    return Milliseconds(sWorld->getIntConfig(CONFIG_OPCODE_PROFILER_SESSION_THRESHOLD));
+}
+
+void OpcodeProfiler::CountCall(OpcodeClient opcode)
+{
+    _counters[opcode].Calls.fetch_add(1, std::memory_order_relaxed);
+}
+
+void OpcodeProfiler::RecordSampledCall(OpcodeClient opcode, std::chrono::nanoseconds time)
+{
+    Counters& counters = _counters[opcode];
+    uint64 nanoseconds = uint64(time.count());
+    counters.Calls.fetch_add(1, std::memory_order_relaxed);
+    counters.SampledCalls.fetch_add(1, std::memory_order_relaxed);
+    counters.SampledTime.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    uint64 maxTime = counters.MaxTime.load(std::memory_order_relaxed);
+    while (nanoseconds > maxTime && !counters.MaxTime.compare_exchange_weak(maxTime, nanoseconds, std::memory_order_relaxed))
+        ;
+
+    std::size_t bucket = std::min<std::size_t>(std::bit_width(uint64(nanoseconds / 1000)), HistogramBuckets - 1);
+    counters.Histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<OpcodeProfiler::OpcodeStats> OpcodeProfiler::GetStats() const
+{
+    std::vector<OpcodeStats> stats;
+    for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        Counters const& counters = _counters[opcode];
+        uint64 calls = counters.Calls.load(std::memory_order_relaxed);
+        if (!calls)
+            continue;
+
+        OpcodeStats& opcodeStats = stats.emplace_back();
+        opcodeStats.Opcode = OpcodeClient(opcode);
+        opcodeStats.Calls = calls;
+        opcodeStats.SampledCalls = counters.SampledCalls.load(std::memory_order_relaxed);
+        opcodeStats.SampledTime = std::chrono::nanoseconds(counters.SampledTime.load(std::memory_order_relaxed));
+        opcodeStats.MaxTime = std::chrono::nanoseconds(counters.MaxTime.load(std::memory_order_relaxed));
+        for (std::size_t i = 0; i < HistogramBuckets; ++i)
+            opcodeStats.Histogram[i] = counters.Histogram[i].load(std::memory_order_relaxed);
+    }
+
+    std::sort(stats.begin(), stats.end(), [](OpcodeStats const& left, OpcodeStats const& right)
+    {
+        return left.GetEstimatedTotalTime() > right.GetEstimatedTotalTime();
+    });
+
+    return stats;
+}
+
+void OpcodeProfiler::Reset()
+{
+    for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        Counters& counters = _counters[opcode];
+        counters.Calls.store(0, std::memory_order_relaxed);
+        counters.SampledCalls.store(0, std::memory_order_relaxed);
+        counters.SampledTime.store(0, std::memory_order_relaxed);
+        counters.MaxTime.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint32>& bucket : counters.Histogram)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void OpcodeProfiler::LogMetrics() const
+{
+    if (!sMetric->IsEnabled() || !IsEnabled())
+        return;
+
+    for (OpcodeStats const& opcodeStats : GetStats())
+    {
+        std::string opcodeName = opcodeTable[opcodeStats.Opcode]->Name;
+        TC_METRIC_VALUE("opcode_calls", opcodeStats.Calls, TC_METRIC_TAG("opcode", opcodeName));
+        TC_METRIC_VALUE("opcode_time_avg", uint64(std::chrono::duration_cast<std::chrono::microseconds>(opcodeStats.GetAverageTime()).count()), TC_METRIC_TAG("opcode", opcodeName));
+        TC_METRIC_VALUE("opcode_time_p99", uint64(opcodeStats.GetPercentile(99.0f).count()), TC_METRIC_TAG("opcode", opcodeName));
+        TC_METRIC_VALUE("opcode_time_max", uint64(std::chrono::duration_cast<std::chrono::microseconds>(opcodeStats.MaxTime).count()), TC_METRIC_TAG("opcode", opcodeName));
+    }
+}
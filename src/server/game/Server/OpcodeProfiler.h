@@ -0,0 +1,107 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_OPCODE_PROFILER_H
+#define TRINITYCORE_OPCODE_PROFILER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "Opcodes.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Collects call counts and sampled handler latencies of client opcodes handled in WorldSession::Update
+class TC_GAME_API OpcodeProfiler
+{
+public:
+    // bucket N counts handler calls shorter than 2^N microseconds, last bucket counts everything longer
+    static constexpr std::size_t HistogramBuckets = 20;
+
+    struct OpcodeStats
+    {
+        OpcodeClient Opcode;
+        uint64 Calls;
+        uint64 SampledCalls;
+        std::chrono::nanoseconds SampledTime;
+        std::chrono::nanoseconds MaxTime;
+        std::array<uint64, HistogramBuckets> Histogram;
+
+        std::chrono::nanoseconds GetAverageTime() const { return SampledCalls ? SampledTime / int64(SampledCalls) : std::chrono::nanoseconds::zero(); }
+        std::chrono::nanoseconds GetEstimatedTotalTime() const { return SampledCalls ? std::chrono::nanoseconds(int64(double(SampledTime.count()) * Calls / SampledCalls)) : std::chrono::nanoseconds::zero(); }
+        // upper bound of the histogram bucket containing given percentile
+        std::chrono::microseconds GetPercentile(float percentile) const;
+    };
+
+    // Handler time spent on a single session, used to spot clients spamming expensive opcodes
+    class SessionStats
+    {
+    public:
+        bool ShouldSample(uint32 sampleRate) { return ++_packetCounter % sampleRate == 0; }
+
+        // Returns true once per window if estimated handler time of the session exceeds threshold
+        bool AddSample(OpcodeClient opcode, std::chrono::nanoseconds estimatedTime, TimePoint now, Milliseconds threshold);
+
+        std::chrono::nanoseconds GetWindowTime() const { return _windowTime; }
+        OpcodeClient GetMostExpensiveOpcode() const;
+
+    private:
+        uint32 _packetCounter = 0;
+        TimePoint _windowStart = TimePoint::min();
+        std::chrono::nanoseconds _windowTime = std::chrono::nanoseconds::zero();
+        bool _reported = false;
+        std::unordered_map<OpcodeClient, std::chrono::nanoseconds> _opcodeTimes;
+    };
+
+    static constexpr Minutes SessionWindow = 1min;
+
+    static OpcodeProfiler* instance();
+
+    bool IsEnabled() const;
+    uint32 GetSampleRate() const;
+    Milliseconds GetSessionThreshold() const;
+
+    void CountCall(OpcodeClient opcode);
+    void RecordSampledCall(OpcodeClient opcode, std::chrono::nanoseconds time);
+
+    // Opcodes that were called at least once, sorted by estimated total handler time
+    std::vector<OpcodeStats> GetStats() const;
+    void Reset();
+
+    void LogMetrics() const;
+
+private:
+    OpcodeProfiler();
+    ~OpcodeProfiler();
+
+    struct Counters
+    {
+        std::atomic<uint64> Calls;
+        std::atomic<uint64> SampledCalls;
+        std::atomic<uint64> SampledTime;
+        std::atomic<uint64> MaxTime;
+        std::array<std::atomic<uint32>, HistogramBuckets> Histogram;
+    };
+
+    std::unique_ptr<Counters[]> _counters;
+};
+
+#define sOpcodeProfiler OpcodeProfiler::instance()
+
+#endif // TRINITYCORE_OPCODE_PROFILER_H
@@ -17,11 +17,21 @@
 
 #include "PacketLog.h"
 #include "Config.h"
+#include "Duration.h"
 #include "IpAddress.h"
+#include "Log.h"
 #include "Realm.h"
+#include "SPSCByteQueue.h"
+#include "StringConvert.h"
 #include "Timer.h"
+#include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <boost/filesystem/operations.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <condition_variable>
+#include <deque>
+#include <thread>
 
 #pragma pack(push, 1)
 
@@ -59,19 +69,325 @@ struct PacketHeader
 
 #pragma pack(pop)
 
-PacketLog::PacketLog() : _file(NULL)
+// Copies packets to per thread queues and writes them to preallocated memory mapped files from a dedicated thread
+// Sending threads never block on a full queue, packets that don't fit in it at the moment are dropped and counted
+// Packets larger than a queue can ever hold are written directly to the file by the sending thread
+// Mapped files survive a crash of the server, only the preallocated tail of the last file is left zeroed
+class PacketLog::Writer
 {
-    std::call_once(_initializeFlag, &PacketLog::Initialize, this);
+public:
+    Writer(std::string const& fileName, std::size_t bufferSize, std::size_t fileSize, Seconds rotateInterval, uint32 maxFiles);
+    ~Writer();
+
+    Writer(Writer const&) = delete;
+    Writer(Writer&&) = delete;
+    Writer& operator=(Writer const&) = delete;
+    Writer& operator=(Writer&&) = delete;
+
+    void Write(PacketHeader const& header, uint8 const* data, std::size_t size);
+    uint64 GetDroppedPacketCount() const { return _droppedPackets.load(std::memory_order_relaxed); }
+
+private:
+    struct ThreadBuffer
+    {
+        explicit ThreadBuffer(std::size_t capacity) : Queue(capacity), Closed(false) { }
+
+        Trinity::SPSCByteQueue Queue;
+        std::atomic<bool> Closed;
+    };
+
+    struct ThreadBufferOwner
+    {
+        ~ThreadBufferOwner()
+        {
+            if (Buffer)
+                Buffer->Closed.store(true, std::memory_order_release);
+        }
+
+        std::shared_ptr<ThreadBuffer> Buffer;
+        uint32 Generation = 0;
+    };
+
+    ThreadBuffer* GetThreadBuffer();
+    void WriteDirect(ThreadBuffer* buffer, PacketHeader const& header, uint8 const* data, std::size_t size);
+    void Run();
+    std::size_t Drain();
+    void Store(void const* data, std::size_t size);
+    bool OpenFile();
+    void CloseFile();
+    void ReportDroppedPackets();
+
+    std::size_t _bufferSize;
+    uint32 _generation;
+
+    std::string _fileNamePrefix;
+    std::string _fileNameExtension;
+    std::size_t _fileSize;
+    Seconds _rotateInterval;
+    uint32 _maxFiles;
+    uint32 _fileIndex;
+
+    boost::iostreams::mapped_file_sink _file;
+    std::string _filePath;
+    std::size_t _fileOffset;
+    TimePoint _fileRotateTime;
+    TimePoint _nextFileOpenAttempt;
+    std::deque<std::string> _filePaths;
+    std::mutex _fileLock;                       // held while writing to the file or draining a queue
+
+    std::mutex _buffersLock;
+    std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+    std::vector<std::shared_ptr<ThreadBuffer>> _drainBuffers;  // only accessed by writer thread
+
+    std::mutex _wakeLock;
+    std::condition_variable _wakeCondition;
+    std::atomic<bool> _stop;
+
+    std::atomic<uint64> _droppedPackets;
+    uint64 _reportedDroppedPackets;
+    TimePoint _nextDroppedPacketsReport;
+
+    std::thread _thread;
+};
+
+namespace
+{
+std::atomic<uint32> PacketLogWriterGeneration = 0;
+}
+
+PacketLog::Writer::Writer(std::string const& fileName, std::size_t bufferSize, std::size_t fileSize, Seconds rotateInterval, uint32 maxFiles) :
+    _bufferSize(bufferSize), _generation(++PacketLogWriterGeneration), _fileSize(fileSize), _rotateInterval(rotateInterval), _maxFiles(maxFiles), _fileIndex(0),
+    _fileOffset(0), _nextFileOpenAttempt(TimePoint::min()), _stop(false), _droppedPackets(0), _reportedDroppedPackets(0), _nextDroppedPacketsReport(TimePoint::min())
+{
+    // World.pkt -> World_<startup timestamp>_0001.pkt, World_<startup timestamp>_0002.pkt, ...
+    std::size_t extensionPos = fileName.find_last_of('.');
+    if (extensionPos != std::string::npos)
+        _fileNameExtension = fileName.substr(extensionPos);
+
+    _fileNamePrefix = fileName.substr(0, extensionPos) + sLog->GetLogsTimestamp();
+
+    OpenFile();
+
+    _thread = std::thread(&Writer::Run, this);
+}
+
+PacketLog::Writer::~Writer()
+{
+    _stop.store(true, std::memory_order_release);
+    _wakeCondition.notify_one();
+    _thread.join();
+
+    CloseFile();
+}
+
+PacketLog::Writer::ThreadBuffer* PacketLog::Writer::GetThreadBuffer()
+{
+    thread_local ThreadBufferOwner threadBuffer;
+    if (threadBuffer.Generation != _generation)
+    {
+        if (threadBuffer.Buffer)
+            threadBuffer.Buffer->Closed.store(true, std::memory_order_release);
+
+        threadBuffer.Buffer = std::make_shared<ThreadBuffer>(_bufferSize);
+        threadBuffer.Generation = _generation;
+
+        std::lock_guard<std::mutex> lock(_buffersLock);
+        _buffers.push_back(threadBuffer.Buffer);
+    }
+
+    return threadBuffer.Buffer.get();
+}
+
+void PacketLog::Writer::Write(PacketHeader const& header, uint8 const* data, std::size_t size)
+{
+    ThreadBuffer* buffer = GetThreadBuffer();
+    if (sizeof(PacketHeader) + size > buffer->Queue.GetMaxRecordSize())
+    {
+        WriteDirect(buffer, header, data, size);
+        return;
+    }
+
+    void* storage = buffer->Queue.Reserve(sizeof(PacketHeader) + size);
+    if (!storage)
+    {
+        _droppedPackets.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    memcpy(storage, &header, sizeof(PacketHeader));
+    if (size)
+        memcpy(static_cast<uint8*>(storage) + sizeof(PacketHeader), data, size);
+
+    buffer->Queue.Commit();
+}
+
+void PacketLog::Writer::WriteDirect(ThreadBuffer* buffer, PacketHeader const& header, uint8 const* data, std::size_t size)
+{
+    std::vector<uint8> record(sizeof(PacketHeader) + size);
+    memcpy(record.data(), &header, sizeof(PacketHeader));
+    if (size)
+        memcpy(record.data() + sizeof(PacketHeader), data, size);
+
+    std::lock_guard<std::mutex> lock(_fileLock);
+
+    // the writer thread is not draining while we hold the lock, store what this thread queued earlier first to keep its order
+    buffer->Queue.Drain([this](void const* queued, std::size_t queuedSize) { Store(queued, queuedSize); });
+    Store(record.data(), record.size());
+}
+
+void PacketLog::Writer::Run()
+{
+    while (!_stop.load(std::memory_order_acquire))
+    {
+        if (_rotateInterval > 0s)
+        {
+            std::lock_guard<std::mutex> lock(_fileLock);
+            if (_fileOffset > sizeof(LogHeader) && std::chrono::steady_clock::now() >= _fileRotateTime)
+            {
+                CloseFile();
+                OpenFile();
+            }
+        }
+
+        if (Drain())
+            continue;
+
+        std::unique_lock<std::mutex> lock(_wakeLock);
+        _wakeCondition.wait_for(lock, 10ms);
+    }
+
+    while (Drain())
+        ;
 }
 
-PacketLog::~PacketLog()
+std::size_t PacketLog::Writer::Drain()
 {
-    if (_file)
-        fclose(_file);
+    {
+        std::lock_guard<std::mutex> lock(_buffersLock);
+        // buffers of finished threads are released once everything they logged has been written
+        std::erase_if(_buffers, [](std::shared_ptr<ThreadBuffer> const& buffer) { return buffer->Closed.load(std::memory_order_acquire) && buffer->Queue.IsEmpty(); });
+        _drainBuffers.assign(_buffers.begin(), _buffers.end());
+    }
 
-    _file = NULL;
+    std::size_t written = 0;
+    {
+        std::lock_guard<std::mutex> lock(_fileLock);
+        for (std::shared_ptr<ThreadBuffer> const& buffer : _drainBuffers)
+            written += buffer->Queue.Drain([this](void const* data, std::size_t size) { Store(data, size); });
+    }
+
+    _drainBuffers.clear();
+
+    ReportDroppedPackets();
+    return written;
 }
 
+void PacketLog::Writer::Store(void const* data, std::size_t size)
+{
+    // would not fit even in an empty file, don't rotate (and possibly delete an old capture) just to drop it
+    if (size > _fileSize - sizeof(LogHeader))
+    {
+        _droppedPackets.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (!_file.is_open() || _fileOffset + size > _fileSize)
+    {
+        CloseFile();
+        if (std::chrono::steady_clock::now() < _nextFileOpenAttempt || !OpenFile() || _fileOffset + size > _fileSize)
+        {
+            _droppedPackets.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    memcpy(_file.data() + _fileOffset, data, size);
+    _fileOffset += size;
+}
+
+bool PacketLog::Writer::OpenFile()
+{
+    _filePath = Trinity::StringFormat("{}_{:04}{}", _fileNamePrefix, ++_fileIndex, _fileNameExtension);
+    _fileOffset = 0;
+    _fileRotateTime = std::chrono::steady_clock::now() + _rotateInterval;
+
+    try
+    {
+        boost::iostreams::mapped_file_params params(_filePath);
+        params.new_file_size = _fileSize;
+        _file.open(params);
+    }
+    catch (std::exception const& e)
+    {
+        TC_LOG_ERROR("network", "PacketLog::Writer::OpenFile: Could not map packet log file {}: {}", _filePath, e.what());
+        _nextFileOpenAttempt = std::chrono::steady_clock::now() + 10s;
+        return false;
+    }
+
+    LogHeader header;
+    header.Signature[0] = 'P'; header.Signature[1] = 'K'; header.Signature[2] = 'T';
+    header.FormatVersion = 0x0301;
+    header.SnifferId = 'T';
+    header.Build = realm.Build;
+    header.Locale[0] = 'e'; header.Locale[1] = 'n'; header.Locale[2] = 'U'; header.Locale[3] = 'S';
+    std::memset(header.SessionKey, 0, sizeof(header.SessionKey));
+    header.SniffStartUnixtime = time(NULL);
+    header.SniffStartTicks = getMSTime();
+    header.OptionalDataSize = 0;
+
+    memcpy(_file.data(), &header, sizeof(header));
+    _fileOffset = sizeof(header);
+
+    _filePaths.push_back(_filePath);
+    if (_maxFiles)
+    {
+        while (_filePaths.size() > _maxFiles)
+        {
+            boost::system::error_code error;
+            boost::filesystem::remove(_filePaths.front(), error);
+            _filePaths.pop_front();
+        }
+    }
+
+    return true;
+}
+
+void PacketLog::Writer::CloseFile()
+{
+    if (!_file.is_open())
+        return;
+
+    _file.close();
+
+    // cut off preallocated space that was never written to
+    boost::system::error_code error;
+    boost::filesystem::resize_file(_filePath, _fileOffset, error);
+}
+
+void PacketLog::Writer::ReportDroppedPackets()
+{
+    uint64 droppedPackets = _droppedPackets.load(std::memory_order_relaxed);
+    if (droppedPackets == _reportedDroppedPackets)
+        return;
+
+    TimePoint now = std::chrono::steady_clock::now();
+    if (now < _nextDroppedPacketsReport)
+        return;
+
+    TC_LOG_WARN("network", "PacketLog::Writer: Dropped {} packets because PacketLog.BufferSize was full or they did not fit in PacketLog.FileSize",
+        droppedPackets - _reportedDroppedPackets);
+
+    _reportedDroppedPackets = droppedPackets;
+    _nextDroppedPacketsReport = now + 10s;
+}
+
+PacketLog::PacketLog()
+{
+    std::call_once(_initializeFlag, &PacketLog::Initialize, this);
+}
+
+PacketLog::~PacketLog() = default;
+
 PacketLog* PacketLog::instance()
 {
     static PacketLog instance;
@@ -87,31 +403,42 @@ void PacketLog::Initialize()
             logsDir.push_back('/');
 
     std::string logname = sConfigMgr->GetStringDefault("PacketLogFile", "");
-    if (!logname.empty())
-    {
-        _file = fopen((logsDir + logname).c_str(), "wb");
+    if (logname.empty())
+        return;
 
-        if (CanLogPacket())
-        {
-            LogHeader header;
-            header.Signature[0] = 'P'; header.Signature[1] = 'K'; header.Signature[2] = 'T';
-            header.FormatVersion = 0x0301;
-            header.SnifferId = 'T';
-            header.Build = realm.Build;
-            header.Locale[0] = 'e'; header.Locale[1] = 'n'; header.Locale[2] = 'U'; header.Locale[3] = 'S';
-            std::memset(header.SessionKey, 0, sizeof(header.SessionKey));
-            header.SniffStartUnixtime = time(NULL);
-            header.SniffStartTicks = getMSTime();
-            header.OptionalDataSize = 0;
-
-            fwrite(&header, sizeof(header), 1, _file);
-        }
-    }
+    std::string accountFilter = sConfigMgr->GetStringDefault("PacketLog.AccountFilter", "");
+    for (std::string_view accountId : Trinity::Tokenize(accountFilter, ' ', false))
+        if (Optional<uint32> id = Trinity::StringTo<uint32>(accountId))
+            _accountFilter.insert(*id);
+
+    std::string opcodeFilter = sConfigMgr->GetStringDefault("PacketLog.OpcodeFilter", "");
+    for (std::string_view opcode : Trinity::Tokenize(opcodeFilter, ' ', false))
+        if (Optional<uint32> id = Trinity::StringTo<uint32>(opcode, 0))
+            _opcodeFilter.insert(*id);
+
+    std::size_t bufferSize = std::max(sConfigMgr->GetIntDefault("PacketLog.BufferSize", 1024 * 1024), 65536);
+    std::size_t fileSize = std::max(sConfigMgr->GetIntDefault("PacketLog.FileSize", 64 * 1024 * 1024), 1024 * 1024);
+    Seconds rotateInterval = Seconds(std::max(sConfigMgr->GetIntDefault("PacketLog.RotateInterval", 0), 0));
+    uint32 maxFiles = std::max(sConfigMgr->GetIntDefault("PacketLog.MaxFiles", 0), 0);
+
+    _writer = std::make_unique<Writer>(logsDir + logname, bufferSize, fileSize, rotateInterval, maxFiles);
+}
+
+bool PacketLog::ShouldLogPacket(uint32 opcode, uint32 accountId) const
+{
+    if (!_accountFilter.empty() && !_accountFilter.contains(accountId))
+        return false;
+
+    if (!_opcodeFilter.empty() && !_opcodeFilter.contains(opcode))
+        return false;
+
+    return true;
 }
 
-void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType)
+void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType, uint32 accountId)
 {
-    std::lock_guard<std::mutex> lock(_logPacketLock);
+    if (!ShouldLogPacket(packet.GetOpcode(), accountId))
+        return;
 
     PacketHeader header;
     header.Direction = direction == CLIENT_TO_SERVER ? 0x47534d43 : 0x47534d53;
@@ -135,9 +462,10 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
     header.Length = packet.size() + sizeof(header.Opcode);
     header.Opcode = packet.GetOpcode();
 
-    fwrite(&header, sizeof(header), 1, _file);
-    if (!packet.empty())
-        fwrite(packet.contents(), 1, packet.size(), _file);
+    _writer->Write(header, !packet.empty() ? packet.contents() : nullptr, packet.size());
+}
 
-    fflush(_file);
+uint64 PacketLog::GetDroppedPacketCount() const
+{
+    return _writer ? _writer->GetDroppedPacketCount() : 0;
 }
@@ -19,7 +19,9 @@
 #define TRINITY_PACKETLOG_H
 
 #include "Common.h"
+#include <memory>
 #include <mutex>
+#include <unordered_set>
 
 enum Direction
 {
@@ -46,18 +48,24 @@ class TC_GAME_API PacketLog
     private:
         PacketLog();
         ~PacketLog();
-        std::mutex _logPacketLock;
         std::once_flag _initializeFlag;
 
     public:
         static PacketLog* instance();
 
         void Initialize();
-        bool CanLogPacket() const { return (_file != NULL); }
-        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType);
+        bool CanLogPacket() const { return _writer != nullptr; }
+        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType, uint32 accountId);
+        uint64 GetDroppedPacketCount() const;
 
     private:
-        FILE* _file;
+        class Writer;
+
+        bool ShouldLogPacket(uint32 opcode, uint32 accountId) const;
+
+        std::unique_ptr<Writer> _writer;
+        std::unordered_set<uint32> _accountFilter;
+        std::unordered_set<uint32> _opcodeFilter;
 };
 
 #define sPacketLog PacketLog::instance()
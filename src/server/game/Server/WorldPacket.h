@@ -42,6 +42,10 @@ class WorldPacket : public ByteBuffer
 
         WorldPacket(uint32 opcode, size_t res, ConnectionType connection = CONNECTION_TYPE_DEFAULT) : WorldPacket(opcode, res, Reserve{}, connection) { }
 
+        // takes over already serialized payload without copying it
+        WorldPacket(uint32 opcode, ByteBuffer&& payload, ConnectionType connection = CONNECTION_TYPE_DEFAULT) : ByteBuffer(std::move(payload)),
+            m_opcode(opcode), _connection(connection) { }
+
         WorldPacket(WorldPacket&& packet) noexcept : ByteBuffer(std::move(packet)), m_opcode(packet.m_opcode), _connection(packet._connection)
         {
         }
@@ -215,16 +215,28 @@ std::string WorldSession::GetPlayerInfo() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/)
+{
+    if (WorldSocket* socket = GetSocketForPacket(packet, forced))
+        socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet, bool forced /*= false*/)
+{
+    if (WorldSocket* socket = GetSocketForPacket(packet.get(), forced))
+        socket->SendPacket(packet);
+}
+
+WorldSocket* WorldSession::GetSocketForPacket(WorldPacket const* packet, bool forced)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of NULL_OPCODE to {}", GetPlayerInfo());
-        return;
+        return nullptr;
     }
     else if (packet->GetOpcode() == UNKNOWN_OPCODE)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of UNKNOWN_OPCODE to {}", GetPlayerInfo());
-        return;
+        return nullptr;
     }
 
     ServerOpcodeHandler const* handler = opcodeTable[static_cast<OpcodeServer>(packet->GetOpcode())];
@@ -232,7 +244,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     if (!handler)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of opcode {} with non existing handler to {}", packet->GetOpcode(), GetPlayerInfo());
-        return;
+        return nullptr;
     }
 
     // Default connection index defined in Opcodes.cpp table
@@ -244,7 +256,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (packet->GetConnection() != CONNECTION_TYPE_INSTANCE && IsInstanceOnlyOpcode(packet->GetOpcode()))
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending of instance only opcode {} with connection type {} to {}", packet->GetOpcode(), uint32(packet->GetConnection()), GetPlayerInfo());
-            return;
+            return nullptr;
         }
 
         conIdx = packet->GetConnection();
@@ -253,7 +265,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     if (!m_Socket[conIdx])
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of {} to non existent socket {} to {}", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())), uint32(conIdx), GetPlayerInfo());
-        return;
+        return nullptr;
     }
 
     if (!forced)
@@ -261,7 +273,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (handler->Status == STATUS_UNHANDLED)
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending disabled opcode {} to {}", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())), GetPlayerInfo());
-            return;
+            return nullptr;
         }
     }
 
@@ -302,7 +314,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     sScriptMgr->OnPacketSend(this, *packet);
 
     TC_LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
-    m_Socket[conIdx]->SendPacket(*packet);
+    return m_Socket[conIdx].get();
 }
 
 /// Add an incoming packet to the queue
@@ -311,6 +323,37 @@ void WorldSession::QueuePacket(WorldPacket* new_packet)
     _recvQueue.add(new_packet);
 }
 
+void WorldSession::CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet)
+{
+    if (!sOpcodeProfiler->IsEnabled())
+    {
+        opHandle->Call(this, packet);
+        return;
+    }
+
+    OpcodeClient opcode = static_cast<OpcodeClient>(packet.GetOpcode());
+    uint32 sampleRate = sOpcodeProfiler->GetSampleRate();
+    if (!_opcodeProfilerStats.ShouldSample(sampleRate))
+    {
+        sOpcodeProfiler->CountCall(opcode);
+        opHandle->Call(this, packet);
+        return;
+    }
+
+    TimePoint start = std::chrono::steady_clock::now();
+    opHandle->Call(this, packet);
+    TimePoint end = std::chrono::steady_clock::now();
+
+    std::chrono::nanoseconds elapsed = end - start;
+    sOpcodeProfiler->RecordSampledCall(opcode, elapsed);
+
+    Milliseconds threshold = sOpcodeProfiler->GetSessionThreshold();
+    if (threshold > 0ms && _opcodeProfilerStats.AddSample(opcode, elapsed * sampleRate, end, threshold))
+        TC_LOG_WARN("network.opcode", "{} used an estimated {} ms of handler time within the last minute, most expensive opcode: {}",
+            GetPlayerInfo(), std::chrono::duration_cast<Milliseconds>(_opcodeProfilerStats.GetWindowTime()).count(),
+            GetOpcodeNameForLogging(_opcodeProfilerStats.GetMostExpensiveOpcode()));
+}
+
 /// Logging helper for unexpected opcodes
 void WorldSession::LogUnexpectedOpcode(WorldPacket* packet, const char* status, const char *reason)
 {
@@ -378,7 +421,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         if(AntiDOS.EvaluateOpcode(*packet, currentTime))
                         {
                             sScriptMgr->OnPacketReceive(this, *packet);
-                            opHandle->Call(this, *packet);
+                            CallOpcodeHandler(opHandle, *packet);
                         }
                         else
                             processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -393,7 +436,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     {
                         // not expected _player or must checked in packet hanlder
                         sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        CallOpcodeHandler(opHandle, *packet);
                     }
                     else
                         processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -406,7 +449,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     else if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                     {
                         sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        CallOpcodeHandler(opHandle, *packet);
                     }
                     else
                         processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -427,7 +470,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                     {
                         sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        CallOpcodeHandler(opHandle, *packet);
                     }
                     else
                         processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
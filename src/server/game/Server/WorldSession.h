@@ -30,6 +30,7 @@
 #include "IteratorPair.h"
 #include "LockedQueue.h"
 #include "ObjectGuid.h"
+#include "OpcodeProfiler.h"
 #include "Optional.h"
 #include "Packet.h"
 #include "RaceMask.h"
@@ -943,6 +944,7 @@ class TC_GAME_API WorldSession
         bool IsAddonRegistered(std::string_view prefix) const;
 
         void SendPacket(WorldPacket const* packet, bool forced = false);
+        void SendPacket(std::shared_ptr<WorldPacket const> const& packet, bool forced = false);
         void AddInstanceConnection(std::shared_ptr<WorldSocket> sock) { m_Socket[CONNECTION_TYPE_INSTANCE] = sock; }
 
         void SendNotification(char const* format, ...) ATTR_PRINTF(2, 3);
@@ -1880,6 +1882,8 @@ class TC_GAME_API WorldSession
         // logging helper
         void LogUnexpectedOpcode(WorldPacket* packet, const char* status, const char *reason);
 
+        void CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet);
+
         // EnumData helpers
         bool IsLegitCharacterForAccount(ObjectGuid lowGUID)
         {
@@ -1892,6 +1896,8 @@ class TC_GAME_API WorldSession
 
         ObjectGuid::LowType m_GUIDLow;                      // set logined or recently logout player (while m_playerRecentlyLogout set)
         Player* _player;
+        WorldSocket* GetSocketForPacket(WorldPacket const* packet, bool forced);
+
         std::shared_ptr<WorldSocket> m_Socket[MAX_CONNECTION_TYPES];
         std::string m_Address;                              // Current Remote Address
      // std::string m_LAddress;                             // Last Attempted Remote Adress - we can not set attempted ip for a non-existing session!
@@ -1930,6 +1936,7 @@ class TC_GAME_API WorldSession
         uint32 recruiterId;
         bool isRecruiter;
         LockedQueue<WorldPacket*> _recvQueue;
+        OpcodeProfiler::SessionStats _opcodeProfilerStats;
         rbac::RBACData* _RBACData;
         uint32 expireTime;
         bool forceExit;
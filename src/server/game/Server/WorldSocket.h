@@ -86,6 +86,8 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    // queues a packet that can be shared with other sockets, its payload is not copied
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
 
     ConnectionType GetConnectionType() const { return _type; }
 
@@ -115,7 +117,7 @@ private:
     void LogOpcodeText(OpcodeClient opcode, std::unique_lock<std::mutex> const& guard) const;
     /// sends and logs network.opcode without accessing WorldSession
     void SendPacketAndLogOpcode(WorldPacket const& packet);
-    void WritePacketToBuffer(EncryptablePacket const& packet, MessageBuffer& buffer);
+    void WritePacketToBuffer(EncryptablePacket const& queued, MessageBuffer& buffer);
     uint32 CompressPacket(uint8* buffer, WorldPacket const& packet);
 
     void HandleSendAuthSession();
@@ -130,6 +132,7 @@ private:
 
     ConnectionType _type;
     uint64 _key;
+    uint32 _accountId;  // set once authenticated, only used for packet log filtering
 
     std::array<uint8, 16> _serverChallenge;
     WorldPacketCrypt _authCrypt;
@@ -33,6 +33,7 @@
 #include "MovementPackets.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "PhasingHandler.h"
@@ -577,6 +578,18 @@ AuraEffect::~AuraEffect()
     delete m_spellmod;
 }
 
+static Trinity::ObjectPool<AuraEffect> AuraEffectPool("AuraEffect");
+
+void* AuraEffect::operator new(size_t size)
+{
+    return AuraEffectPool.Allocate(size);
+}
+
+void AuraEffect::operator delete(void* ptr, size_t size)
+{
+    AuraEffectPool.Deallocate(ptr, size);
+}
+
 template <typename Container>
 void AuraEffect::GetTargetList(Container& targetContainer) const
 {
@@ -37,6 +37,9 @@ class TC_GAME_API AuraEffect
         explicit AuraEffect(Aura* base, SpellEffectInfo const& spellEfffectInfo, int32 const* baseAmount, Unit* caster);
 
     public:
+        void* operator new(size_t size);
+        void operator delete(void* ptr, size_t size);
+
         Unit* GetCaster() const { return GetBase()->GetCaster(); }
         ObjectGuid GetCasterGUID() const { return GetBase()->GetCasterGUID(); }
         Aura* GetBase() const { return m_base; }
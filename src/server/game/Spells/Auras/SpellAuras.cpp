@@ -25,6 +25,7 @@
 #include "Log.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "PhasingHandler.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -2459,6 +2460,18 @@ UnitAura::UnitAura(AuraCreateInfo const& createInfo)
     GetUnitOwner()->_AddAura(this, createInfo.Caster);
 }
 
+static Trinity::ObjectPool<UnitAura> UnitAuraPool("UnitAura");
+
+void* UnitAura::operator new(size_t size)
+{
+    return UnitAuraPool.Allocate(size);
+}
+
+void UnitAura::operator delete(void* ptr, size_t size)
+{
+    UnitAuraPool.Deallocate(ptr, size);
+}
+
 void UnitAura::_ApplyForTarget(Unit* target, Unit* caster, AuraApplication* aurApp)
 {
     Aura::_ApplyForTarget(target, caster, aurApp);
@@ -2617,6 +2630,18 @@ DynObjAura::DynObjAura(AuraCreateInfo const& createInfo)
     GetDynobjOwner()->SetAura(this);
 }
 
+static Trinity::ObjectPool<DynObjAura> DynObjAuraPool("DynObjAura");
+
+void* DynObjAura::operator new(size_t size)
+{
+    return DynObjAuraPool.Allocate(size);
+}
+
+void DynObjAura::operator delete(void* ptr, size_t size)
+{
+    DynObjAuraPool.Deallocate(ptr, size);
+}
+
 void DynObjAura::Remove(AuraRemoveMode removeMode)
 {
     if (IsRemoved())
@@ -364,6 +364,9 @@ class TC_GAME_API UnitAura : public Aura
     protected:
         explicit UnitAura(AuraCreateInfo const& createInfo);
     public:
+        void* operator new(size_t size);
+        void operator delete(void* ptr, size_t size);
+
         void _ApplyForTarget(Unit* target, Unit* caster, AuraApplication* aurApp) override;
         void _UnapplyForTarget(Unit* target, Unit* caster, AuraApplication* aurApp) override;
 
@@ -388,6 +391,9 @@ class TC_GAME_API DynObjAura : public Aura
     protected:
         explicit DynObjAura(AuraCreateInfo const& createInfo);
     public:
+        void* operator new(size_t size);
+        void operator delete(void* ptr, size_t size);
+
         DynObjAura(SpellInfo const* spellproto, ObjectGuid castId, uint32 effMask, WorldObject* owner, Unit* caster, Difficulty castDifficulty, int32 *baseAmount, Item* castItem, ObjectGuid casterGUID, ObjectGuid castItemGuid, uint32 castItemId, int32 castItemLevel);
 
         void Remove(AuraRemoveMode removeMode = AURA_REMOVE_BY_DEFAULT) override;
@@ -44,6 +44,7 @@
 #include "LootMgr.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "PathGenerator.h"
 #include "Pet.h"
 #include "PhasingHandler.h"
@@ -632,6 +633,18 @@ Spell::~Spell()
     delete m_spellValue;
 }
 
+static Trinity::ObjectPool<Spell> SpellPool("Spell");
+
+void* Spell::operator new(size_t size)
+{
+    return SpellPool.Allocate(size);
+}
+
+void Spell::operator delete(void* ptr, size_t size)
+{
+    SpellPool.Deallocate(ptr, size);
+}
+
 void Spell::InitExplicitTargets(SpellCastTargets const& targets)
 {
     m_targets = targets;
@@ -62,6 +62,61 @@ namespace
         >
     > mSpellInfoMap;
 
+    // Dense spell id index over mSpellInfoMap, all difficulty variants of a spell are stored next to each other in mSpellInfoLookupVariants
+    // Spell ids outside of it (serverside spells with ids beyond Spell.db2) are looked up in mSpellInfoMap directly
+    struct SpellInfoLookupEntry
+    {
+        uint32 VariantsOffset = 0;
+        uint32 VariantsCount = 0;
+    };
+
+    std::vector<SpellInfoLookupEntry> mSpellInfoLookup;
+    std::vector<SpellInfo const*> mSpellInfoLookupVariants;
+
+    // every difficulty followed by its fallback difficulties, in the order GetSpellInfo tries them
+    std::vector<std::vector<Difficulty>> mDifficultyFallbackChains;
+
+    void BuildSpellInfoLookup()
+    {
+        mSpellInfoLookup.assign(sSpellStore.GetNumRows(), SpellInfoLookupEntry());
+        mSpellInfoLookupVariants.clear();
+
+        for (SpellInfo const& spellInfo : mSpellInfoMap)
+            if (spellInfo.Id < mSpellInfoLookup.size())
+                ++mSpellInfoLookup[spellInfo.Id].VariantsCount;
+
+        uint32 offset = 0;
+        for (SpellInfoLookupEntry& entry : mSpellInfoLookup)
+        {
+            entry.VariantsOffset = offset;
+            offset += entry.VariantsCount;
+            entry.VariantsCount = 0;
+        }
+
+        mSpellInfoLookupVariants.resize(offset);
+        for (SpellInfo const& spellInfo : mSpellInfoMap)
+        {
+            if (spellInfo.Id >= mSpellInfoLookup.size())
+                continue;
+
+            SpellInfoLookupEntry& entry = mSpellInfoLookup[spellInfo.Id];
+            mSpellInfoLookupVariants[entry.VariantsOffset + entry.VariantsCount++] = &spellInfo;
+        }
+
+        mDifficultyFallbackChains.assign(sDifficultyStore.GetNumRows(), {});
+        for (std::size_t difficulty = 0; difficulty < mDifficultyFallbackChains.size(); ++difficulty)
+        {
+            std::vector<Difficulty>& chain = mDifficultyFallbackChains[difficulty];
+            chain.push_back(Difficulty(difficulty));
+            DifficultyEntry const* difficultyEntry = sDifficultyStore.LookupEntry(difficulty);
+            while (difficultyEntry && chain.size() <= mDifficultyFallbackChains.size())
+            {
+                chain.push_back(Difficulty(difficultyEntry->FallbackDifficultyID));
+                difficultyEntry = sDifficultyStore.LookupEntry(difficultyEntry->FallbackDifficultyID);
+            }
+        }
+    }
+
     class ServersideSpellName
     {
     public:
@@ -125,7 +180,7 @@ bool IsPartOfSkillLine(uint32 skillId, uint32 spellId)
     return false;
 }
 
-SpellMgr::SpellMgr() { }
+SpellMgr::SpellMgr() : mSpellProcsGeneration(0) { }
 
 SpellMgr::~SpellMgr()
 {
@@ -681,6 +736,30 @@ CreatureImmunities const* SpellMgr::GetCreatureImmunities(int32 creatureImmuniti
 
 SpellInfo const* SpellMgr::GetSpellInfo(uint32 spellId, Difficulty difficulty) const
 {
+    if (spellId < mSpellInfoLookup.size())
+    {
+        SpellInfoLookupEntry const& entry = mSpellInfoLookup[spellId];
+        auto variantsBegin = mSpellInfoLookupVariants.begin() + entry.VariantsOffset;
+        auto variantsEnd = variantsBegin + entry.VariantsCount;
+        auto findVariant = [&](Difficulty variantDifficulty) -> SpellInfo const*
+        {
+            for (auto itr = variantsBegin; itr != variantsEnd; ++itr)
+                if ((*itr)->Difficulty == variantDifficulty)
+                    return *itr;
+
+            return nullptr;
+        };
+
+        if (difficulty >= mDifficultyFallbackChains.size())
+            return findVariant(difficulty);
+
+        for (Difficulty fallbackDifficulty : mDifficultyFallbackChains[difficulty])
+            if (SpellInfo const* spellInfo = findVariant(fallbackDifficulty))
+                return spellInfo;
+
+        return nullptr;
+    }
+
     auto itr = mSpellInfoMap.find(boost::make_tuple(spellId, difficulty));
     if (itr != mSpellInfoMap.end())
         return &*itr;
@@ -1482,6 +1561,7 @@ void SpellMgr::LoadSpellProcs()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcMap.clear();                             // need for reload case
+    ++mSpellProcsGeneration;
 
     //                                                     0           1                2                 3                 4                 5                 6
     QueryResult result = WorldDatabase.Query("SELECT SpellId, SchoolMask, SpellFamilyName, SpellFamilyMask0, SpellFamilyMask1, SpellFamilyMask2, SpellFamilyMask3, "
@@ -2664,12 +2744,16 @@ void SpellMgr::LoadSpellInfoStore()
         mSpellInfoMap.emplace(spellEntry, data.first.second, data.second);
     }
 
+    BuildSpellInfoLookup();
+
     TC_LOG_INFO("server.loading", ">> Loaded SpellInfo store in {} ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
 void SpellMgr::UnloadSpellInfoStore()
 {
     mSpellInfoMap.clear();
+    mSpellInfoLookup.clear();
+    mSpellInfoLookupVariants.clear();
     mServersideSpellNames.clear();
 }
 
@@ -2911,6 +2995,8 @@ void SpellMgr::LoadSpellInfoServerside()
         } while (spellsResult->NextRow());
     }
 
+    BuildSpellInfoLookup();
+
     TC_LOG_INFO("server.loading", ">> Loaded {} serverside spells {} ms", mServersideSpellNames.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
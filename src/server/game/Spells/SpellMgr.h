@@ -722,6 +722,8 @@ class TC_GAME_API SpellMgr
         // Spell proc table
         SpellProcEntry const* GetSpellProcEntry(SpellInfo const* spellInfo) const;
         static bool CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo);
+        // incremented on every spell_proc (re)load, proc entries of older generations are no longer valid
+        uint32 GetSpellProcsGeneration() const { return mSpellProcsGeneration; }
 
         // Spell threat table
         SpellThreatEntry const* GetSpellThreatEntry(uint32 spellID) const;
@@ -823,6 +825,7 @@ class TC_GAME_API SpellMgr
         PetLevelupSpellMap         mPetLevelupSpellMap;
         PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
         SpellTotemModelMap         mSpellTotemModel;
+        uint32                     mSpellProcsGeneration;
 };
 
 #define sSpellMgr SpellMgr::instance()
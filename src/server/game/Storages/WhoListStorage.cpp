@@ -29,11 +29,45 @@ WhoListStorageMgr* WhoListStorageMgr::instance()
     return &instance;
 }
 
+bool WhoListPlayerInfo::Update(Player const* player)
+{
+    _team = player->GetTeam();
+    _security = player->GetSession()->GetSecurity();
+    _level = player->GetLevel();
+    _class = player->GetClass();
+    _race = player->GetRace();
+    _zoneid = player->GetZoneId();
+    _gender = player->GetNativeGender();
+    _visible = player->IsVisible();
+    _gamemaster = player->IsGameMaster();
+
+    if (_playerName != player->GetName() || _widePlayerName.empty())
+    {
+        _playerName = player->GetName();
+        if (!Utf8toWStr(_playerName, _widePlayerName))
+            return false;
+
+        wstrToLower(_widePlayerName);
+    }
+
+    Guild const* guild = player->GetGuild();
+    _guildguid = guild ? guild->GetGUID() : ObjectGuid::Empty;
+
+    if (guild ? _guildName != guild->GetName() : !_guildName.empty())
+    {
+        _guildName = guild ? guild->GetName() : "";
+        if (!Utf8toWStr(_guildName, _wideGuildName))
+            return false;
+
+        wstrToLower(_wideGuildName);
+    }
+
+    return true;
+}
+
 void WhoListStorageMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
-    _whoListStorage.reserve(sWorld->GetPlayerCount()+1);
+    std::vector<bool> updated(_whoListStorage.size(), false);
 
     HashMapHolder<Player>::MapType const& m = ObjectAccessor::GetPlayers();
     for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
@@ -41,28 +75,30 @@ void WhoListStorageMgr::Update()
         if (!itr->second->FindMap() || itr->second->GetSession()->PlayerLoading())
             continue;
 
-        std::string playerName = itr->second->GetName();
-        std::wstring widePlayerName;
-        if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+        auto [indexItr, isNew] = _whoListIndex.try_emplace(itr->first, _whoListStorage.size());
+        if (isNew)
+        {
+            _whoListStorage.emplace_back(itr->first);
+            updated.push_back(false);
+        }
 
-        wstrToLower(widePlayerName);
+        updated[indexItr->second] = _whoListStorage[indexItr->second].Update(itr->second);
+    }
 
-        std::string guildName = sGuildMgr->GetGuildNameById(itr->second->GetGuildId());
-        std::wstring wideGuildName;
-        if (!Utf8toWStr(guildName, wideGuildName))
+    // drop players that logged out or whose names can't be searched
+    for (std::size_t i = _whoListStorage.size(); i > 0; --i)
+    {
+        std::size_t index = i - 1;
+        if (updated[index])
             continue;
 
-        wstrToLower(wideGuildName);
-
-        Guild* guild = itr->second->GetGuild();
-        ObjectGuid guildGuid;
-
-        if (guild)
-            guildGuid = guild->GetGUID();
+        _whoListIndex.erase(_whoListStorage[index].GetGuid());
+        if (index != _whoListStorage.size() - 1)
+        {
+            _whoListStorage[index] = std::move(_whoListStorage.back());
+            _whoListIndex[_whoListStorage[index].GetGuid()] = index;
+        }
 
-        _whoListStorage.emplace_back(itr->second->GetGUID(), itr->second->GetTeam(), itr->second->GetSession()->GetSecurity(), itr->second->GetLevel(),
-            itr->second->GetClass(), itr->second->GetRace(), itr->second->GetZoneId(), itr->second->GetNativeGender(), itr->second->IsVisible(),
-            itr->second->IsGameMaster(), widePlayerName, wideGuildName, playerName, guildName, guildGuid);
+        _whoListStorage.pop_back();
     }
 }
@@ -20,14 +20,17 @@
 
 #include "Common.h"
 #include "ObjectGuid.h"
+#include <unordered_map>
+
+class Player;
 
 class WhoListPlayerInfo
 {
+    friend class WhoListStorageMgr;
+
 public:
-    WhoListPlayerInfo(ObjectGuid guid, uint32 team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, bool gamemaster, std::wstring const& widePlayerName,
-        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName, ObjectGuid guildguid) :
-        _guid(guid), _team(team), _security(security), _level(level), _class(clss), _race(race), _zoneid(zoneid), _gender(gender), _visible(visible),
-        _gamemaster(gamemaster), _widePlayerName(widePlayerName), _wideGuildName(wideGuildName), _playerName(playerName), _guildName(guildName), _guildguid(guildguid) {}
+    explicit WhoListPlayerInfo(ObjectGuid guid) : _guid(guid), _team(0), _security(SEC_PLAYER), _level(0), _class(0), _race(0), _zoneid(0), _gender(0),
+        _visible(false), _gamemaster(false) { }
 
     ObjectGuid GetGuid() const { return _guid; }
     uint32 GetTeam() const { return _team; }
@@ -46,6 +49,9 @@ public:
     ObjectGuid GetGuildGuid() const { return _guildguid; }
 
 private:
+    // returns false if names can't be converted for searching, lowercased names are only rebuilt when they change
+    bool Update(Player const* player);
+
     ObjectGuid _guid;
     uint32 _team;
     AccountTypes _security;
@@ -74,11 +80,13 @@ private:
 public:
     static WhoListStorageMgr* instance();
 
+    // refreshes entries of online players in place, adds players that logged in and removes those that logged out
     void Update();
     WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
 
 protected:
     WhoListInfoVector _whoListStorage;
+    std::unordered_map<ObjectGuid, std::size_t> _whoListIndex;  // index into _whoListStorage
 };
 
 #define sWhoListStorageMgr WhoListStorageMgr::instance()
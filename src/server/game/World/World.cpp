@@ -1562,6 +1562,15 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_SHOW_MUTE_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowMuteInWorld", false);
     m_bool_configs[CONFIG_SHOW_BAN_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowBanInWorld", false);
     m_int_configs[CONFIG_NUMTHREADS] = sConfigMgr->GetIntDefault("MapUpdate.Threads", 1);
+
+    m_float_configs[CONFIG_CREATURE_UPDATE_LOD_DISTANCE] = sConfigMgr->GetFloatDefault("Creature.UpdateLOD.Distance", 0.0f);
+    if (m_float_configs[CONFIG_CREATURE_UPDATE_LOD_DISTANCE] < 0.0f)
+    {
+        TC_LOG_ERROR("server.loading", "Creature.UpdateLOD.Distance ({}) can't be negative. Set to 0 (disabled).", m_float_configs[CONFIG_CREATURE_UPDATE_LOD_DISTANCE]);
+        m_float_configs[CONFIG_CREATURE_UPDATE_LOD_DISTANCE] = 0.0f;
+    }
+    m_int_configs[CONFIG_CREATURE_UPDATE_LOD_INTERVAL] = sConfigMgr->GetIntDefault("Creature.UpdateLOD.Interval", 500);
+    m_int_configs[CONFIG_CREATURE_UPDATE_LOD_MAX_UPDATES] = sConfigMgr->GetIntDefault("Creature.UpdateLOD.MaxUpdatesPerTick", 0);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetIntDefault("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1656,6 +1665,16 @@ void World::LoadConfigSettings(bool reload)
 
     m_int_configs[CONFIG_PACKET_SPOOF_BANDURATION] = sConfigMgr->GetIntDefault("PacketSpoof.BanDuration", 86400);
 
+    // opcode profiler
+    m_bool_configs[CONFIG_OPCODE_PROFILER_ENABLED] = sConfigMgr->GetBoolDefault("OpcodeProfiler.Enable", false);
+    m_int_configs[CONFIG_OPCODE_PROFILER_SAMPLE_RATE] = sConfigMgr->GetIntDefault("OpcodeProfiler.SampleRate", 16);
+    if (m_int_configs[CONFIG_OPCODE_PROFILER_SAMPLE_RATE] < 1)
+    {
+        TC_LOG_ERROR("server.loading", "OpcodeProfiler.SampleRate ({}) must be > 0. Using 1 instead.", m_int_configs[CONFIG_OPCODE_PROFILER_SAMPLE_RATE]);
+        m_int_configs[CONFIG_OPCODE_PROFILER_SAMPLE_RATE] = 1;
+    }
+    m_int_configs[CONFIG_OPCODE_PROFILER_SESSION_THRESHOLD] = sConfigMgr->GetIntDefault("OpcodeProfiler.SessionThreshold", 2000);
+
     m_bool_configs[CONFIG_IP_BASED_ACTION_LOGGING] = sConfigMgr->GetBoolDefault("Allow.IP.Based.Action.Logging", false);
 
     // AHBot
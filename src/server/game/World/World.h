@@ -197,6 +197,7 @@ enum WorldBoolConfigs
     CONFIG_ALLOW_LOGGING_IP_ADDRESSES_IN_DATABASE,
     CONFIG_CHARACTER_CREATING_DISABLE_ALLIED_RACE_ACHIEVEMENT_REQUIREMENT,
     CONFIG_BATTLEGROUNDMAP_LOAD_GRIDS,
+    CONFIG_OPCODE_PROFILER_ENABLED,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -224,6 +225,7 @@ enum WorldFloatConfigs
     CONFIG_CALL_TO_ARMS_5_PCT,
     CONFIG_CALL_TO_ARMS_10_PCT,
     CONFIG_CALL_TO_ARMS_20_PCT,
+    CONFIG_CREATURE_UPDATE_LOD_DISTANCE,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -404,6 +406,8 @@ enum WorldIntConfigs
     CONFIG_PACKET_SPOOF_POLICY,
     CONFIG_PACKET_SPOOF_BANMODE,
     CONFIG_PACKET_SPOOF_BANDURATION,
+    CONFIG_OPCODE_PROFILER_SAMPLE_RATE,
+    CONFIG_OPCODE_PROFILER_SESSION_THRESHOLD,
     CONFIG_ACC_PASSCHANGESEC,
     CONFIG_BG_REWARD_WINNER_HONOR_FIRST,
     CONFIG_BG_REWARD_WINNER_HONOR_LAST,
@@ -437,6 +441,8 @@ enum WorldIntConfigs
     CONFIG_BLACKMARKET_MAXAUCTIONS,
     CONFIG_BLACKMARKET_UPDATE_PERIOD,
     CONFIG_FACTION_BALANCE_LEVEL_CHECK_DIFF,
+    CONFIG_CREATURE_UPDATE_LOD_INTERVAL,
+    CONFIG_CREATURE_UPDATE_LOD_MAX_UPDATES,
     INT_CONFIG_VALUE_COUNT
 };
 
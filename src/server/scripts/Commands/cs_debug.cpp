@@ -45,6 +45,9 @@ EndScriptData */
 #include "MovementPackets.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
+#include "OpcodeProfiler.h"
+#include "Pet.h"
 #include "PhasingHandler.h"
 #include "PoolMgr.h"
 #include "RBAC.h"
@@ -126,6 +129,9 @@ public:
             { "asan outofbounds",   HandleDebugOutOfBounds,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "guidlimits",         HandleDebugGuidLimitsCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "objectcount",        HandleDebugObjectCountCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "objectmemory",       HandleDebugObjectMemoryCommand,        rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "objectpools",        HandleDebugObjectPoolsCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "opcodestats",        HandleDebugOpcodeStatsCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "questreset",         HandleDebugQuestResetCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "warden force",       HandleDebugWardenForce,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "personalclone",      HandleDebugBecomePersonalClone,        rbac::RBAC_PERM_COMMAND_DEBUG,   Console::No }
@@ -1675,6 +1681,36 @@ public:
         return true;
     }
 
+    static bool HandleDebugOpcodeStatsCommand(ChatHandler* handler, Optional<EXACT_SEQUENCE("reset")> reset, Optional<uint32> count)
+    {
+        if (reset)
+        {
+            sOpcodeProfiler->Reset();
+            handler->SendSysMessage("Opcode statistics reset.");
+            return true;
+        }
+
+        if (!sOpcodeProfiler->IsEnabled())
+            handler->SendSysMessage("Opcode profiler is disabled (OpcodeProfiler.Enable), showing previously collected statistics.");
+
+        std::vector<OpcodeProfiler::OpcodeStats> stats = sOpcodeProfiler->GetStats();
+        if (stats.size() > count.value_or(10))
+            stats.resize(count.value_or(10));
+
+        handler->PSendSysMessage("Top %u opcodes by estimated handler time:", uint32(stats.size()));
+        for (OpcodeProfiler::OpcodeStats const& opcodeStats : stats)
+        {
+            handler->PSendSysMessage("%s: calls " UI64FMTD ", total ~" UI64FMTD " ms, avg " UI64FMTD " us, p50 <= " UI64FMTD " us, p99 <= " UI64FMTD " us, max " UI64FMTD " us",
+                opcodeTable[opcodeStats.Opcode]->Name, opcodeStats.Calls,
+                uint64(std::chrono::duration_cast<Milliseconds>(opcodeStats.GetEstimatedTotalTime()).count()),
+                uint64(std::chrono::duration_cast<std::chrono::microseconds>(opcodeStats.GetAverageTime()).count()),
+                uint64(opcodeStats.GetPercentile(50.0f).count()), uint64(opcodeStats.GetPercentile(99.0f).count()),
+                uint64(std::chrono::duration_cast<std::chrono::microseconds>(opcodeStats.MaxTime).count()));
+        }
+
+        return true;
+    }
+
     class CreatureCountWorker
     {
     public:
@@ -1729,6 +1765,86 @@ public:
             handler->PSendSysMessage("Entry: %u Count: %u", p.first, p.second);
     }
 
+    class ObjectMemoryWorker
+    {
+    public:
+        struct TypeStats
+        {
+            uint64 Objects = 0;
+            uint64 ValuesBytes = 0;
+            uint64 ChangesMasks = 0;
+            uint64 ChangesMaskBytes = 0;
+            uint64 DynamicValues = 0;
+            uint64 DynamicValuesBytes = 0;
+        };
+
+        template<class T>
+        void Visit(std::unordered_map<ObjectGuid, T*>& objectMap)
+        {
+            for (auto const& [guid, object] : objectMap)
+            {
+                UpdateFieldMemoryUsage usage = object->GetUpdateFieldMemoryUsage();
+                TypeStats& stats = _stats[object->GetTypeId()];
+                ++stats.Objects;
+                stats.ValuesBytes += usage.Values;
+                stats.ChangesMasks += usage.ChangesMask ? 1 : 0;
+                stats.ChangesMaskBytes += usage.ChangesMask;
+                stats.DynamicValues += usage.DynamicValues ? 1 : 0;
+                stats.DynamicValuesBytes += usage.DynamicValues;
+            }
+        }
+
+        std::array<TypeStats, NUM_CLIENT_OBJECT_TYPES> const& GetStats() const { return _stats; }
+
+    private:
+        std::array<TypeStats, NUM_CLIENT_OBJECT_TYPES> _stats;
+    };
+
+    static void HandleDebugObjectMemoryMap(ChatHandler* handler, Map* map)
+    {
+        static char const* const TypeNames[NUM_CLIENT_OBJECT_TYPES] =
+        {
+            "Object", "Item", "Container", "Unit", "Player", "GameObject", "DynamicObject", "Corpse", "AreaTrigger", "SceneObject", "Conversation"
+        };
+
+        ObjectMemoryWorker worker;
+        TypeContainerVisitor<ObjectMemoryWorker, MapStoredObjectTypesContainer> visitor(worker);
+        visitor.Visit(map->GetObjectsStore());
+
+        handler->PSendSysMessage("Map Id: %u Name: '%s' Instance Id: %u", map->GetId(), map->GetMapName(), map->GetInstanceId());
+        for (std::size_t typeId = 0; typeId < NUM_CLIENT_OBJECT_TYPES; ++typeId)
+        {
+            ObjectMemoryWorker::TypeStats const& stats = worker.GetStats()[typeId];
+            if (!stats.Objects)
+                continue;
+
+            handler->PSendSysMessage("%s: " UI64FMTD " objects, values " UI64FMTD " KB, change masks " UI64FMTD " (" UI64FMTD " KB), dynamic fields " UI64FMTD " (" UI64FMTD " KB)",
+                TypeNames[typeId], stats.Objects, stats.ValuesBytes / 1024, stats.ChangesMasks, stats.ChangesMaskBytes / 1024, stats.DynamicValues, stats.DynamicValuesBytes / 1024);
+        }
+    }
+
+    static bool HandleDebugObjectMemoryCommand(ChatHandler* handler, Optional<uint32> mapId)
+    {
+        if (mapId)
+            sMapMgr->DoForAllMapsWithMapId(*mapId, [handler](Map* map) { HandleDebugObjectMemoryMap(handler, map); });
+        else
+            sMapMgr->DoForAllMaps([handler](Map* map) { HandleDebugObjectMemoryMap(handler, map); });
+
+        return true;
+    }
+
+    static bool HandleDebugObjectPoolsCommand(ChatHandler* handler)
+    {
+        for (Trinity::ObjectPoolStatistics const& stats : Trinity::ObjectPoolBase::GetAllStatistics())
+        {
+            uint64 liveObjects = stats.Allocations - stats.Deallocations;
+            handler->PSendSysMessage("%s (slot %u bytes): " UI64FMTD " live, " UI64FMTD " slots in " UI64FMTD " slabs (" UI64FMTD " KB), " UI64FMTD " free in shared list, allocations " UI64FMTD ", fallbacks " UI64FMTD,
+                stats.Name, uint32(stats.SlotSize), liveObjects, stats.Capacity, stats.Slabs, stats.Capacity * stats.SlotSize / 1024, stats.CentralFreeSlots, stats.Allocations, stats.Fallbacks);
+        }
+
+        return true;
+    }
+
     static bool HandleDebugBecomePersonalClone(ChatHandler* handler)
     {
         Creature* selection = handler->getSelectedCreature();
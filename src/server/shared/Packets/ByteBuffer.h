@@ -91,6 +91,12 @@ class TC_SHARED_API ByteBuffer
 
         ByteBuffer(MessageBuffer&& buffer);
 
+        // takes over previously allocated storage to reuse its capacity, contents are discarded
+        explicit ByteBuffer(std::vector<uint8>&& storage) noexcept : _rpos(0), _wpos(0), _bitpos(InitialBitPos), _curbitval(0), _storage(std::move(storage))
+        {
+            _storage.clear();
+        }
+
         std::vector<uint8>&& Move() noexcept
         {
             _rpos = 0;
@@ -534,6 +540,7 @@ class TC_SHARED_API ByteBuffer
         }
 
         size_t size() const { return _storage.size(); }
+        size_t capacity() const { return _storage.capacity(); }
         bool empty() const { return _storage.empty(); }
 
         void resize(size_t newsize)
@@ -38,6 +38,7 @@
 #include "MapManager.h"
 #include "Metric.h"
 #include "MySQLThreading.h"
+#include "OpcodeProfiler.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvP/OutdoorPvPMgr.h"
 #include "ProcessPriority.h"
@@ -49,6 +50,7 @@
 #include "TCSoap.h"
 #include "TerrainMgr.h"
 #include "ThreadPool.h"
+#include "UpdateData.h"
 #include "World.h"
 #include "WorldSocket.h"
 #include "WorldSocketMgr.h"
@@ -198,8 +200,7 @@ extern int main(int argc, char** argv)
     std::shared_ptr<Trinity::Asio::IoContext> ioContext = std::make_shared<Trinity::Asio::IoContext>();
 
     sLog->RegisterAppender<AppenderDB>();
-    // If logs are supposed to be handled async then we need to pass the IoContext into the Log singleton
-    sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false) ? ioContext.get() : nullptr);
+    sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false));
 
     Trinity::Banner::Show("worldserver-daemon",
         [](char const* text)
@@ -287,6 +288,12 @@ extern int main(int argc, char** argv)
         TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        sOpcodeProfiler->LogMetrics();
+
+        UpdateData::BufferStats updateBufferStats = UpdateData::GetBufferStats();
+        TC_METRIC_VALUE("update_data_buffers_allocated", updateBufferStats.Allocated);
+        TC_METRIC_VALUE("update_data_buffers_reused", updateBufferStats.Reused);
+        TC_METRIC_VALUE("update_data_buffers_grown", updateBufferStats.Grown);
     });
 
     TC_METRIC_EVENT("events", "Worldserver started", "");
@@ -0,0 +1,287 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Define.h"
+#include "Optional.h"
+#include "StringConvert.h"
+#include "StringFormat.h"
+#include <boost/filesystem/operations.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace po = boost::program_options;
+
+#pragma pack(push, 1)
+
+// PKT 3.1 format, must match structures written by PacketLog
+struct LogHeader
+{
+    char Signature[3];
+    uint16 FormatVersion;
+    uint8 SnifferId;
+    uint32 Build;
+    char Locale[4];
+    uint8 SessionKey[40];
+    uint32 SniffStartUnixtime;
+    uint32 SniffStartTicks;
+    uint32 OptionalDataSize;
+};
+
+struct PacketHeader
+{
+    uint32 Direction;
+    uint32 ConnectionId;
+    uint32 ArrivalTicks;
+    uint32 OptionalDataSize;
+    uint32 Length;
+};
+
+#pragma pack(pop)
+
+constexpr uint32 DirectionClientToServer = 0x47534d43;
+constexpr uint32 DirectionServerToClient = 0x47534d53;
+
+struct Options
+{
+    std::vector<std::string> Files;
+    std::unordered_set<uint32> Opcodes;
+    Optional<uint32> Direction;
+    bool Summary = false;
+    bool HexDump = false;
+    bool Repair = false;
+};
+
+struct OpcodeStats
+{
+    uint64 Count = 0;
+    uint64 Bytes = 0;
+};
+
+Optional<int> HandleArgs(int argc, char* argv[], Options* options);
+
+static void HexDump(uint8 const* data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i += 16)
+    {
+        std::string line = Trinity::StringFormat("    {:08X} ", i);
+        for (std::size_t j = i; j < i + 16; ++j)
+        {
+            if (j < size)
+                line += Trinity::StringFormat(" {:02X}", data[j]);
+            else
+                line += "   ";
+        }
+
+        line += "  ";
+        for (std::size_t j = i; j < std::min(i + 16, size); ++j)
+            line += (data[j] >= 0x20 && data[j] < 0x7F) ? char(data[j]) : '.';
+
+        std::cout << line << '\n';
+    }
+}
+
+// Returns number of bytes holding complete packets
+static std::size_t ReadFile(std::string const& fileName, Options const& options, std::map<uint32, OpcodeStats>& stats)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Could not open " << fileName << '\n';
+        return 0;
+    }
+
+    std::vector<uint8> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    LogHeader logHeader;
+    if (data.size() < sizeof(logHeader))
+    {
+        std::cerr << fileName << " is too small to be a packet log\n";
+        return 0;
+    }
+
+    memcpy(&logHeader, data.data(), sizeof(logHeader));
+    if (memcmp(logHeader.Signature, "PKT", 3) != 0 || logHeader.FormatVersion != 0x0301)
+    {
+        std::cerr << fileName << " is not a PKT 3.1 file\n";
+        return 0;
+    }
+
+    std::size_t offset = sizeof(logHeader) + logHeader.OptionalDataSize;
+    std::cout << Trinity::StringFormat("{}: build {} started at {}\n", fileName, logHeader.Build, logHeader.SniffStartUnixtime);
+
+    uint32 packets = 0;
+    while (offset + sizeof(PacketHeader) <= data.size())
+    {
+        PacketHeader header;
+        memcpy(&header, &data[offset], sizeof(header));
+
+        // files of a server that did not shut down cleanly end with preallocated zeroed space
+        if (header.Direction != DirectionClientToServer && header.Direction != DirectionServerToClient)
+            break;
+
+        std::size_t packetOffset = offset + sizeof(header) + header.OptionalDataSize;
+        if (header.Length < sizeof(uint32) || packetOffset + header.Length > data.size())
+            break;
+
+        uint32 opcode;
+        memcpy(&opcode, &data[packetOffset], sizeof(opcode));
+        uint8 const* payload = &data[packetOffset + sizeof(opcode)];
+        std::size_t payloadSize = header.Length - sizeof(opcode);
+
+        offset = packetOffset + header.Length;
+        ++packets;
+
+        if (!options.Opcodes.empty() && !options.Opcodes.contains(opcode))
+            continue;
+
+        if (options.Direction && *options.Direction != header.Direction)
+            continue;
+
+        if (options.Summary)
+        {
+            OpcodeStats& opcodeStats = stats[opcode];
+            ++opcodeStats.Count;
+            opcodeStats.Bytes += payloadSize;
+            continue;
+        }
+
+        std::cout << Trinity::StringFormat("{:>10} {} connection {} opcode 0x{:05X} size {}\n", header.ArrivalTicks,
+            header.Direction == DirectionClientToServer ? "C->S" : "S->C", header.ConnectionId, opcode, payloadSize);
+
+        if (options.HexDump)
+            HexDump(payload, payloadSize);
+    }
+
+    std::cout << Trinity::StringFormat("{}: {} packets", fileName, packets);
+    if (offset != data.size())
+        std::cout << Trinity::StringFormat(", {} trailing bytes without complete packets", data.size() - offset);
+    std::cout << '\n';
+
+    return offset;
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (Optional<int> exitCode = HandleArgs(argc, argv, &options))
+        return *exitCode;
+
+    std::map<uint32, OpcodeStats> stats;
+    for (std::string const& fileName : options.Files)
+    {
+        std::size_t validSize = ReadFile(fileName, options, stats);
+        if (options.Repair && validSize)
+        {
+            boost::system::error_code error;
+            if (boost::filesystem::file_size(fileName, error) != validSize)
+            {
+                boost::filesystem::resize_file(fileName, validSize, error);
+                if (error)
+                    std::cerr << "Could not truncate " << fileName << ": " << error.message() << '\n';
+                else
+                    std::cout << "Truncated " << fileName << " to " << validSize << " bytes\n";
+            }
+        }
+    }
+
+    if (options.Summary)
+    {
+        std::vector<std::pair<uint32, OpcodeStats>> sorted(stats.begin(), stats.end());
+        std::sort(sorted.begin(), sorted.end(), [](std::pair<uint32, OpcodeStats> const& left, std::pair<uint32, OpcodeStats> const& right)
+        {
+            return left.second.Bytes > right.second.Bytes;
+        });
+
+        std::cout << "   opcode      count        bytes\n";
+        for (std::pair<uint32, OpcodeStats> const& opcodeStats : sorted)
+            std::cout << Trinity::StringFormat("  0x{:05X} {:>10} {:>12}\n", opcodeStats.first, opcodeStats.second.Count, opcodeStats.second.Bytes);
+    }
+
+    return 0;
+}
+
+Optional<int> HandleArgs(int argc, char* argv[], Options* options)
+{
+    std::vector<std::string> opcodes;
+    std::string direction;
+
+    po::options_description visible("Usage: packetlogreader [OPTION]... [FILE]...\n\nWhere OPTION can be any of");
+    visible.add_options()
+        ("help,h", "print usage message")
+        ("opcode,o", po::value(&opcodes)->composing(), "only show given opcode, can be repeated (hexadecimal values need 0x prefix)")
+        ("direction,d", po::value(&direction), "only show packets sent in given direction (cs or sc)")
+        ("summary,s", po::bool_switch(&options->Summary), "print packet count and size per opcode instead of listing packets")
+        ("hex,x", po::bool_switch(&options->HexDump), "dump packet contents")
+        ("repair", po::bool_switch(&options->Repair), "truncate files after last complete packet (removes preallocated space left by a crashed server)");
+
+    po::options_description all;
+    all.add(visible);
+    all.add_options()
+        ("file", po::value(&options->Files)->composing(), "packet log files");
+
+    po::positional_options_description positional;
+    positional.add("file", -1);
+
+    po::variables_map variablesMap;
+    try
+    {
+        store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), variablesMap);
+        notify(variablesMap);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    if (variablesMap.contains("help") || options->Files.empty())
+    {
+        std::cout << visible << '\n';
+        return 0;
+    }
+
+    for (std::string const& opcode : opcodes)
+    {
+        Optional<uint32> value = Trinity::StringTo<uint32>(opcode, 0);
+        if (!value)
+        {
+            std::cerr << "Invalid opcode " << opcode << '\n';
+            return 1;
+        }
+
+        options->Opcodes.insert(*value);
+    }
+
+    if (direction == "cs")
+        options->Direction = DirectionClientToServer;
+    else if (direction == "sc")
+        options->Direction = DirectionServerToClient;
+    else if (!direction.empty())
+    {
+        std::cerr << "Invalid direction " << direction << ", use cs or sc\n";
+        return 1;
+    }
+
+    return {};
+}